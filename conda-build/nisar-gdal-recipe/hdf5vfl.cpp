@@ -1,19 +1,222 @@
 // hdf5vfl.cpp
 #include "hdf5vfl.h"
 #include "cpl_port.h"
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
 #include "cpl_vsi.h"
 
 #include <algorithm>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 #include <cstring> // For memset
 
 namespace NisarVFL {
 
 static std::mutex gMutex;
 static hid_t hFileDriver = -1;
+static hid_t hVectorDXPL = -1;
 
 #define MAXADDR ((static_cast<haddr_t>(1) << (8 * sizeof(haddr_t) - 1)) - 1)
 
+// --------------------------------------------------------------------------
+// Open Footprint (Metadata Record & Replay)
+// --------------------------------------------------------------------------
+// Opening a NISAR product touches the same few hundred KB of superblock,
+// object header, B-tree and heap bytes every time. When
+// NISAR_OPEN_FOOTPRINT_CACHE points at a directory, every metadata read made
+// while NisarDataset::Open runs is recorded together with its bytes and
+// persisted as a footprint file keyed by granule identity (path, size, mtime).
+// The next open loads the footprint up front and serves HDF5's metadata reads
+// from memory instead of issuing one latency-bound request per read.
+//
+// NISAR_OPEN_FOOTPRINT_MODE:
+//   CONTENTS (default) - serve the persisted bytes directly (zero requests).
+//   PREFETCH           - only trust the persisted ranges and re-fetch them
+//                        from the source in one coalesced multi-range read.
+
+static const char szFootprintMagic[8] = {'N', 'I', 'S', 'A', 'R', 'F', 'P', '1'};
+
+struct FootprintSession
+{
+    std::mutex oMutex;
+    bool bAttached = false;
+    bool bRecording = true;
+    bool bDirty = false;       // New extents recorded since load
+    std::string osFileName;    // File the session is attached to
+    std::string osCachePath;   // Footprint file for this granule
+    size_t nMaxBytes = 0;
+    size_t nCachedBytes = 0;
+    size_t nHits = 0;
+    size_t nMisses = 0;
+
+    // Non-overlapping extents, keyed by file offset
+    std::map<haddr_t, std::vector<GByte>> oExtents;
+
+    bool Lookup(haddr_t nAddr, size_t nSize, void *pDst)
+    {
+        auto it = oExtents.upper_bound(nAddr);
+        if (it == oExtents.begin()) return false;
+        --it;
+        const haddr_t nStart = it->first;
+        const haddr_t nEnd = nStart + it->second.size();
+        if (nAddr < nStart || nAddr + nSize > nEnd) return false;
+        memcpy(pDst, it->second.data() + (nAddr - nStart), nSize);
+        return true;
+    }
+
+    void AddExtent(haddr_t nAddr, const GByte *pabyData, size_t nSize)
+    {
+        if (nSize == 0 || nCachedBytes + nSize > nMaxBytes) return;
+
+        haddr_t nStart = nAddr;
+        haddr_t nEnd = nAddr + nSize;
+
+        // Collect every extent that overlaps or touches [nStart, nEnd)
+        auto itFirst = oExtents.upper_bound(nStart);
+        if (itFirst != oExtents.begin()) {
+            auto itPrev = std::prev(itFirst);
+            if (itPrev->first + itPrev->second.size() >= nStart) itFirst = itPrev;
+        }
+        auto itLast = itFirst;
+        while (itLast != oExtents.end() && itLast->first <= nEnd) {
+            nStart = std::min(nStart, itLast->first);
+            nEnd = std::max(nEnd, static_cast<haddr_t>(itLast->first + itLast->second.size()));
+            ++itLast;
+        }
+
+        std::vector<GByte> abyMerged(static_cast<size_t>(nEnd - nStart));
+        size_t nRemoved = 0;
+        for (auto it = itFirst; it != itLast; ++it) {
+            memcpy(abyMerged.data() + (it->first - nStart), it->second.data(), it->second.size());
+            nRemoved += it->second.size();
+        }
+        memcpy(abyMerged.data() + (nAddr - nStart), pabyData, nSize);
+
+        oExtents.erase(itFirst, itLast);
+        nCachedBytes = nCachedBytes - nRemoved + abyMerged.size();
+        oExtents.emplace(nStart, std::move(abyMerged));
+        bDirty = true;
+    }
+};
+
+// Handed from the OpenFootprintScope to HDF5_vsil_open on the same thread,
+// since H5Fopen calls back into the driver synchronously.
+static thread_local std::shared_ptr<FootprintSession> tl_poPendingFootprint;
+
+static std::string BuildFootprintPath(const char *pszDir, const char *pszName,
+                                      haddr_t nFileSize)
+{
+    VSIStatBufL sStat;
+    GIntBig nMTime = 0;
+    if (VSIStatL(pszName, &sStat) == 0) nMTime = static_cast<GIntBig>(sStat.st_mtime);
+
+    // FNV-1a over the granule identity
+    std::string osKey = CPLSPrintf("%s|" CPL_FRMT_GUIB "|" CPL_FRMT_GIB, pszName,
+                                   static_cast<GUIntBig>(nFileSize), nMTime);
+    GUInt64 nHash = 1469598103934665603ULL;
+    for (unsigned char c : osKey) {
+        nHash ^= c;
+        nHash *= 1099511628211ULL;
+    }
+    return CPLFormFilename(pszDir, CPLSPrintf("nisar_footprint_%016llx.bin",
+                                              static_cast<unsigned long long>(nHash)), nullptr);
+}
+
+// Footprint layout (host byte order, cache-local):
+//   magic[8] | u64 nExtents | { u64 offset | u64 size | bytes[size] } * nExtents
+static bool LoadFootprint(FootprintSession &oSession, VSILFILE *fpSource, haddr_t nEOF)
+{
+    VSILFILE *fp = VSIFOpenL(oSession.osCachePath.c_str(), "rb");
+    if (!fp) return false;
+
+    const bool bPrefetch = EQUAL(CPLGetConfigOption("NISAR_OPEN_FOOTPRINT_MODE", "CONTENTS"), "PREFETCH");
+
+    char szMagic[8] = {};
+    GUInt64 nExtents = 0;
+    bool bOK = VSIFReadL(szMagic, 1, 8, fp) == 8 &&
+               memcmp(szMagic, szFootprintMagic, 8) == 0 &&
+               VSIFReadL(&nExtents, sizeof(nExtents), 1, fp) == 1;
+
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    std::vector<std::vector<GByte>> aoData;
+
+    for (GUInt64 i = 0; bOK && i < nExtents; i++) {
+        GUInt64 anHeader[2] = {0, 0};
+        if (VSIFReadL(anHeader, sizeof(GUInt64), 2, fp) != 2 ||
+            anHeader[0] + anHeader[1] > nEOF || anHeader[1] > oSession.nMaxBytes) {
+            bOK = false;
+            break;
+        }
+        anOffsets.push_back(static_cast<vsi_l_offset>(anHeader[0]));
+        anSizes.push_back(static_cast<size_t>(anHeader[1]));
+        aoData.emplace_back(static_cast<size_t>(anHeader[1]));
+        if (bPrefetch) {
+            bOK = VSIFSeekL(fp, VSIFTellL(fp) + anHeader[1], SEEK_SET) == 0;
+        } else {
+            bOK = VSIFReadL(aoData.back().data(), 1, aoData.back().size(), fp) == aoData.back().size();
+        }
+    }
+    VSIFCloseL(fp);
+
+    if (!bOK) {
+        CPLDebug("NISAR_VFL", "Discarding unreadable footprint %s", oSession.osCachePath.c_str());
+        return false;
+    }
+
+    if (bPrefetch && !anOffsets.empty()) {
+        std::vector<void*> apData;
+        for (auto &oData : aoData) apData.push_back(oData.data());
+        if (VSIFReadMultiRangeL(static_cast<int>(anOffsets.size()), apData.data(),
+                                anOffsets.data(), anSizes.data(), fpSource) != 0) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < aoData.size(); i++) {
+        oSession.AddExtent(static_cast<haddr_t>(anOffsets[i]), aoData[i].data(), aoData[i].size());
+    }
+    oSession.bDirty = false;
+
+    CPLDebug("NISAR_VFL", "Loaded open footprint %s (%d extents, %.1f KB, mode=%s)",
+             oSession.osCachePath.c_str(), static_cast<int>(anOffsets.size()),
+             oSession.nCachedBytes / 1024.0, bPrefetch ? "PREFETCH" : "CONTENTS");
+    return true;
+}
+
+static void SaveFootprint(FootprintSession &oSession)
+{
+    // Write to a temporary name and rename, so concurrent readers never see
+    // a partially written footprint
+    std::string osTmp = oSession.osCachePath + CPLSPrintf(".%p.tmp", static_cast<void*>(&oSession));
+    VSILFILE *fp = VSIFOpenL(osTmp.c_str(), "wb");
+    if (!fp) return;
+
+    GUInt64 nExtents = oSession.oExtents.size();
+    bool bOK = VSIFWriteL(szFootprintMagic, 1, 8, fp) == 8 &&
+               VSIFWriteL(&nExtents, sizeof(nExtents), 1, fp) == 1;
+    for (const auto &oExtent : oSession.oExtents) {
+        if (!bOK) break;
+        GUInt64 anHeader[2] = {static_cast<GUInt64>(oExtent.first),
+                               static_cast<GUInt64>(oExtent.second.size())};
+        bOK = VSIFWriteL(anHeader, sizeof(GUInt64), 2, fp) == 2 &&
+              VSIFWriteL(oExtent.second.data(), 1, oExtent.second.size(), fp) == oExtent.second.size();
+    }
+    bOK = (VSIFCloseL(fp) == 0) && bOK;
+
+    if (bOK && VSIRename(osTmp.c_str(), oSession.osCachePath.c_str()) == 0) {
+        CPLDebug("NISAR_VFL", "Saved open footprint %s (%d extents, %.1f KB)",
+                 oSession.osCachePath.c_str(), static_cast<int>(nExtents),
+                 oSession.nCachedBytes / 1024.0);
+    } else {
+        VSIUnlink(osTmp.c_str());
+    }
+}
+
 // --------------------------------------------------------------------------
 // VFL State Structure
 // --------------------------------------------------------------------------
@@ -23,6 +226,7 @@ typedef struct HDF5_vsil_t
     VSILFILE *fp = nullptr;
     haddr_t eoa = 0;
     haddr_t eof = 0;
+    std::shared_ptr<FootprintSession> poFootprint; // Null unless footprints are enabled
 } HDF5_vsil_t;
 
 // --------------------------------------------------------------------------
@@ -62,6 +266,27 @@ static H5FD_t *HDF5_vsil_open(const char *name, unsigned flags,
     VSIFSeekL(fh->fp, 0, SEEK_END);
     fh->eof = static_cast<haddr_t>(VSIFTellL(fh->fp));
 
+    // Attach a pending open footprint (read-only opens only). Re-opens of
+    // the same file within one scope (e.g. the page-size discovery pass)
+    // share the session; the footprint is only loaded on first attach.
+    if (tl_poPendingFootprint && !(H5F_ACC_RDWR & flags))
+    {
+        auto poSession = tl_poPendingFootprint;
+        if (!poSession->bAttached)
+        {
+            const char *pszDir = CPLGetConfigOption("NISAR_OPEN_FOOTPRINT_CACHE", nullptr);
+            poSession->bAttached = true;
+            poSession->osFileName = name;
+            poSession->osCachePath = BuildFootprintPath(pszDir, name, fh->eof);
+            LoadFootprint(*poSession, fh->fp, fh->eof);
+            fh->poFootprint = poSession;
+        }
+        else if (poSession->osFileName == name)
+        {
+            fh->poFootprint = poSession;
+        }
+    }
+
     return reinterpret_cast<H5FD_t *>(fh);
 }
 
@@ -100,13 +325,178 @@ static haddr_t HDF5_vsil_get_eof(const H5FD_t *_file, H5FD_mem_t /* type */)
     return fh->eof;
 }
 
-static herr_t HDF5_vsil_read(H5FD_t *_file, H5FD_mem_t /* type */,
+static herr_t HDF5_vsil_read(H5FD_t *_file, H5FD_mem_t type,
                              hid_t /* dxpl_id */, haddr_t addr, size_t size,
                              void *buf /*out*/)
 {
     HDF5_vsil_t *fh = reinterpret_cast<HDF5_vsil_t *>(_file);
+
+    FootprintSession *poFootprint = fh->poFootprint.get();
+    if (poFootprint) {
+        std::lock_guard<std::mutex> oLock(poFootprint->oMutex);
+        if (poFootprint->Lookup(addr, size, buf)) {
+            poFootprint->nHits++;
+            return 0;
+        }
+        poFootprint->nMisses++;
+    }
+
     VSIFSeekL(fh->fp, static_cast<vsi_l_offset>(addr), SEEK_SET);
-    return VSIFReadL(buf, size, 1, fh->fp) == 1 ? 0 : -1;
+    if (VSIFReadL(buf, size, 1, fh->fp) != 1) return -1;
+
+    // Record metadata reads only; raw chunk data would bloat the footprint
+    if (poFootprint && type != H5FD_MEM_DRAW) {
+        std::lock_guard<std::mutex> oLock(poFootprint->oMutex);
+        if (poFootprint->bRecording) {
+            poFootprint->AddExtent(addr, static_cast<const GByte*>(buf), size);
+        }
+    }
+    return 0;
+}
+
+// --------------------------------------------------------------------------
+// Vectored Reads (HDF5 1.14+)
+// --------------------------------------------------------------------------
+// HDF5 hands over many (addr, size) pairs at once when selection I/O is
+// active. Instead of N serial seek+read round trips, we sort the requests,
+// merge the ones separated by small gaps and hand the merged spans to
+// VSIFReadMultiRangeL, which /vsicurl/ and /vsis3/ serve in parallel.
+static herr_t HDF5_vsil_read_vector(H5FD_t *_file, hid_t /* dxpl_id */,
+                                    uint32_t count, H5FD_mem_t /* types */[],
+                                    haddr_t addrs[], size_t sizes[],
+                                    void *bufs[] /*out*/)
+{
+    HDF5_vsil_t *fh = reinterpret_cast<HDF5_vsil_t *>(_file);
+    if (count == 0) return 0;
+
+    struct VectorReq {
+        haddr_t nAddr;
+        size_t nSize;
+        GByte* pabyDst;
+    };
+
+    // 1. Expand the HDF5 shorthand: a 0 size means "same as the previous
+    //    one for the rest of the list"
+    std::vector<VectorReq> aoReqs;
+    aoReqs.reserve(count);
+    size_t nCurSize = 0;
+    bool bSizesFixed = false;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!bSizesFixed) {
+            if (sizes[i] == 0) bSizesFixed = true;
+            else nCurSize = sizes[i];
+        }
+        if (nCurSize == 0) continue;
+        aoReqs.push_back({addrs[i], nCurSize, static_cast<GByte*>(bufs[i])});
+    }
+    if (aoReqs.empty()) return 0;
+
+    std::sort(aoReqs.begin(), aoReqs.end(),
+              [](const VectorReq& a, const VectorReq& b) { return a.nAddr < b.nAddr; });
+
+    // 2. Coalesce neighbours. Default gap of 64 KiB is below the cost of one
+    //    extra S3 round trip at typical in-region bandwidth.
+    const haddr_t nMaxGap = static_cast<haddr_t>(
+        CPLAtoGIntBig(CPLGetConfigOption("NISAR_VFL_COALESCE_GAP", "65536")));
+    const haddr_t nMaxSpan = static_cast<haddr_t>(
+        CPLAtoGIntBig(CPLGetConfigOption("NISAR_VFL_COALESCE_MAX_BYTES", "16777216")));
+
+    struct MergedRange {
+        haddr_t nStart;
+        haddr_t nEnd;
+        size_t nFirstReq;
+        size_t nLastReq;
+    };
+    std::vector<MergedRange> aoRanges;
+    for (size_t i = 0; i < aoReqs.size(); i++) {
+        const haddr_t nReqEnd = aoReqs[i].nAddr + aoReqs[i].nSize;
+        if (!aoRanges.empty()) {
+            MergedRange& oLast = aoRanges.back();
+            if (aoReqs[i].nAddr <= oLast.nEnd + nMaxGap &&
+                std::max(oLast.nEnd, nReqEnd) - oLast.nStart <= nMaxSpan) {
+                oLast.nEnd = std::max(oLast.nEnd, nReqEnd);
+                oLast.nLastReq = i;
+                continue;
+            }
+        }
+        aoRanges.push_back({aoReqs[i].nAddr, nReqEnd, i, i});
+    }
+
+    // 3. Clamp to EOF. Bytes past the physical end read as zeros, which
+    //    matches the behaviour of the sec2 driver.
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    std::vector<void*> apData;
+    std::vector<std::vector<GByte>> aoStaging(aoRanges.size());
+    std::vector<size_t> anRangeSlot(aoRanges.size(), static_cast<size_t>(-1));
+
+    for (size_t r = 0; r < aoRanges.size(); r++) {
+        const MergedRange& oRange = aoRanges[r];
+        const haddr_t nReadEnd = std::min(oRange.nEnd, fh->eof);
+        if (oRange.nStart >= nReadEnd) continue;
+
+        const size_t nReadSize = static_cast<size_t>(nReadEnd - oRange.nStart);
+        void* pTarget = nullptr;
+
+        // A lone request that is fully inside the file can land directly
+        // in the HDF5 buffer without a staging copy
+        if (oRange.nFirstReq == oRange.nLastReq &&
+            nReadSize == aoReqs[oRange.nFirstReq].nSize) {
+            pTarget = aoReqs[oRange.nFirstReq].pabyDst;
+        } else {
+            aoStaging[r].resize(nReadSize);
+            pTarget = aoStaging[r].data();
+        }
+
+        anRangeSlot[r] = anOffsets.size();
+        anOffsets.push_back(static_cast<vsi_l_offset>(oRange.nStart));
+        anSizes.push_back(nReadSize);
+        apData.push_back(pTarget);
+    }
+
+    if (!anOffsets.empty()) {
+        if (VSIFReadMultiRangeL(static_cast<int>(anOffsets.size()), apData.data(),
+                                anOffsets.data(), anSizes.data(), fh->fp) != 0) {
+            return -1;
+        }
+    }
+
+    // 4. Scatter the merged spans back into the individual HDF5 buffers
+    for (size_t r = 0; r < aoRanges.size(); r++) {
+        const MergedRange& oRange = aoRanges[r];
+        const GByte* pabyStaging = aoStaging[r].empty() ? nullptr : aoStaging[r].data();
+        const size_t nStagingSize = aoStaging[r].size();
+
+        for (size_t i = oRange.nFirstReq; i <= oRange.nLastReq; i++) {
+            VectorReq& oReq = aoReqs[i];
+            if (anRangeSlot[r] != static_cast<size_t>(-1) && pabyStaging == nullptr) {
+                continue; // Read directly into the destination
+            }
+            const size_t nRel = static_cast<size_t>(oReq.nAddr - oRange.nStart);
+            size_t nAvail = (nRel < nStagingSize) ? nStagingSize - nRel : 0;
+            size_t nCopy = std::min(nAvail, oReq.nSize);
+            if (nCopy > 0) memcpy(oReq.pabyDst, pabyStaging + nRel, nCopy);
+            if (nCopy < oReq.nSize) memset(oReq.pabyDst + nCopy, 0, oReq.nSize - nCopy);
+        }
+    }
+
+    CPLDebug("NISAR_VFL", "read_vector: %u requests coalesced into %d ranges",
+             count, static_cast<int>(anOffsets.size()));
+    return 0;
+}
+
+static herr_t HDF5_vsil_read_selection(H5FD_t *_file, H5FD_mem_t type,
+                                       hid_t dxpl_id, size_t count,
+                                       hid_t mem_spaces[], hid_t file_spaces[],
+                                       haddr_t offsets[], size_t element_sizes[],
+                                       void *bufs[] /*out*/)
+{
+    // Let HDF5 flatten the dataspace selections into (addr, size) pairs;
+    // it calls back into read_vector above, so the coalescing applies here too.
+    return H5FDread_vector_from_selection(_file, type, dxpl_id,
+                                          static_cast<uint32_t>(count),
+                                          mem_spaces, file_spaces, offsets,
+                                          element_sizes, bufs);
 }
 
 static herr_t HDF5_vsil_write(H5FD_t *_file, H5FD_mem_t /* type */,
@@ -171,9 +561,9 @@ static const H5FD_class_t HDF5_vsil_g = {
     nullptr,                         /* 27: get_handle */
     HDF5_vsil_read,                  /* 28: read */
     HDF5_vsil_write,                 /* 29: write */
-    nullptr,                         /* 30: read_vector */
+    HDF5_vsil_read_vector,           /* 30: read_vector */
     nullptr,                         /* 31: write_vector */
-    nullptr,                         /* 32: read_selection */
+    HDF5_vsil_read_selection,        /* 32: read_selection */
     nullptr,                         /* 33: write_selection */
     nullptr,                         /* 34: flush */
     HDF5_vsil_truncate,              /* 35: truncate */
@@ -210,10 +600,72 @@ hid_t HDF5VFLGetFileDriver()
     return hFileDriver;
 }
 
+hid_t HDF5VFLGetVectorDXPL()
+{
+    std::lock_guard<std::mutex> oLock(gMutex);
+    if (hVectorDXPL < 0)
+    {
+        hVectorDXPL = H5Pcreate(H5P_DATASET_XFER);
+#if H5_VERSION_GE(1, 14, 1)
+        // Ask HDF5 to route raw data through read_selection/read_vector
+        // so multi-chunk H5Dread calls reach the VFL as one batch.
+        if (hVectorDXPL >= 0 &&
+            CPLTestBool(CPLGetConfigOption("NISAR_VFL_VECTOR_IO", "YES")))
+        {
+            H5Pset_selection_io(hVectorDXPL, H5D_SELECTION_IO_MODE_ON);
+        }
+#endif
+    }
+    return hVectorDXPL >= 0 ? hVectorDXPL : H5P_DEFAULT;
+}
+
+OpenFootprintScope::OpenFootprintScope()
+{
+    const char *pszDir = CPLGetConfigOption("NISAR_OPEN_FOOTPRINT_CACHE", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0') return;
+
+    VSIStatBufL sStat;
+    if (VSIStatL(pszDir, &sStat) != 0 && VSIMkdirRecursive(pszDir, 0755) != 0) {
+        CPLDebug("NISAR_VFL", "Footprint cache directory %s is not usable", pszDir);
+        return;
+    }
+
+    m_poSession = std::make_shared<FootprintSession>();
+    m_poSession->nMaxBytes = static_cast<size_t>(
+        CPLAtoGIntBig(CPLGetConfigOption("NISAR_OPEN_FOOTPRINT_MAX_BYTES", "8388608")));
+    tl_poPendingFootprint = m_poSession;
+}
+
+OpenFootprintScope::~OpenFootprintScope()
+{
+    if (!m_poSession) return;
+    if (tl_poPendingFootprint == m_poSession) tl_poPendingFootprint.reset();
+
+    // Stop recording; the extents stay live to serve lazy metadata reads
+    std::lock_guard<std::mutex> oLock(m_poSession->oMutex);
+    m_poSession->bRecording = false;
+    if (!m_poSession->bAttached) return;
+
+    CPLDebug("NISAR_VFL", "Open footprint: %d hits, %d misses",
+             static_cast<int>(m_poSession->nHits), static_cast<int>(m_poSession->nMisses));
+
+    // Persist when this open touched ranges the footprint did not cover yet
+    // (first open, or a different subdataset of the same granule)
+    if (m_poSession->bDirty) {
+        SaveFootprint(*m_poSession);
+        m_poSession->bDirty = false;
+    }
+}
+
 void HDF5VFLUnloadFileDriver()
 {
     {
         std::lock_guard<std::mutex> oLock(gMutex);
+        if (hVectorDXPL >= 0)
+        {
+            H5Pclose(hVectorDXPL);
+            hVectorDXPL = -1;
+        }
         if (hFileDriver >= 0)
         {
             H5FDunregister(hFileDriver);
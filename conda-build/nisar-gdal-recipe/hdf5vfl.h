@@ -21,6 +21,8 @@
 #include "cpl_port.h"
 #include <hdf5.h>
 
+#include <memory>
+
 // --------------------------------------------------------------------------
 // CRITICAL: Namespace isolation for out-of-tree plugins.
 // Prevents symbol collision with GDAL's internal HDF5/NetCDF drivers.
@@ -30,6 +32,27 @@ namespace NisarVFL {
     // All the heavy lifting (structs, static functions) stays hidden inside hdf5vfl.cpp
     hid_t HDF5VFLGetFileDriver();
     void HDF5VFLUnloadFileDriver();
+
+    // Shared transfer property list with selection/vector I/O enabled.
+    // Falls back to H5P_DEFAULT on libraries without selection I/O.
+    hid_t HDF5VFLGetVectorDXPL();
+
+    struct FootprintSession;
+
+    // RAII scope around NisarDataset::Open. While alive, the next file opened
+    // through the VFL on this thread records its metadata reads (or replays a
+    // previously saved footprint). Does nothing unless
+    // NISAR_OPEN_FOOTPRINT_CACHE is set.
+    class OpenFootprintScope
+    {
+        std::shared_ptr<FootprintSession> m_poSession;
+
+      public:
+        OpenFootprintScope();
+        ~OpenFootprintScope();
+        OpenFootprintScope(const OpenFootprintScope&) = delete;
+        OpenFootprintScope& operator=(const OpenFootprintScope&) = delete;
+    };
 }
 
 #endif /* HDF5VFL_H_INCLUDED_ */
@@ -60,9 +60,21 @@ void GDALRegister_NISAR()
                                GDAL_DMD_OPENOPTIONLIST,
                                R"(<OpenOptionList>
                                   <Option name='ENABLE_PAGE_BUFFERING' type='boolean' description='Perform discovery pass to align HDF5 page buffering. (Note: Driver defaults to 4MB speculative alignment if NO)' default='NO'/>
+                                  <Option name='PAGE_BUFFER_COUNT' type='int' description='Number of file-space pages held by the page buffer when ENABLE_PAGE_BUFFERING=YES' default='32'/>
+                                  <Option name='PAGE_BUFFER_SIZE_MB' type='int' description='Override total HDF5 page buffer size in MiB (0 disables page buffering)'/>
+                                  <Option name='CHUNK_CACHE_MB' type='int' description='Override HDF5 raw data chunk cache size in MiB (default: sized from chunk shape)'/>
+                                  <Option name='CHUNK_CACHE_SLOTS' type='int' description='Override number of HDF5 chunk cache hash slots'/>
+                                  <Option name='SCAN_ORDER' type='string-select' description='Block visiting order for multi-block reads. AUTO streams full-extent reads and full-width reads of whole block rows in file-offset order' default='AUTO'>
+                                  <Value>AUTO</Value>
+                                  <Value>FILE_OFFSET</Value>
+                                  <Value>ROW_MAJOR</Value>
+                                  </Option>
+                                  <Option name='BLOCK_MULTIPLE' type='string' description='Report blocks made of N (or NxM) HDF5 chunks, e.g. 4 or 4x2'/>
+                                  <Option name='BLOCK_SIZE' type='string' description='Report blocks of about WxH pixels, rounded to whole HDF5 chunks (overrides BLOCK_MULTIPLE)'/>
+                                  <Option name='STRIP_HEIGHT' type='int' description='Rows per block for contiguous or compact layers (default: about NISAR_STRIP_BYTES per strip)'/>
                                   <Option name='INST' type='string' description='Instrument to open' default='LSAR'/>
                                   <Option name='FREQ' type='string' description='Frequency band to open' default='A'/>
-                                  <Option name='POL' type='string' description='Polarization to open (e.g., HHHH, HH)'/>
+                                  <Option name='POL' type='string' description='Polarization to open (e.g., HHHH, HH), a comma-separated list such as HHHH,HVHV,VVVV, or ALL; each term becomes one band'/>
                                   <Option name='METADATA' type='string' description='Filter specific metadata domains to load'/>
                                   <Option name='DEM_FILE' type='string' description='Path to DEM for 3D cube interpolation'/>
                                   <Option name='DEM_RESAMPLING' type='string-select' description='DEM interpolation method' default='CUBICSPLINE'>
@@ -73,6 +85,25 @@ void GDALRegister_NISAR()
                                   </Option>
                                   <Option name='QUANTITY' type='string' description='Quantity to interpolate'/>
                                   <Option name='MASK' type='boolean' description='Apply valid data mask (default NO)'/>
+                                  <Option name='APPLY_MASK' type='boolean' description='Write nodata (NaN on floating-point bands) where the layer mask is invalid, during chunk decode (default NO)'/>
+                                  <Option name='DERIVED' type='string-select' description='Serve a complex layer as a Float32 quantity computed during chunk decode'>
+                                  <Value>AMPLITUDE</Value>
+                                  <Value>PHASE</Value>
+                                  <Value>INTENSITY</Value>
+                                  <Value>DB</Value>
+                                  <Value>REAL</Value>
+                                  <Value>IMAG</Value>
+                                  </Option>
+                                  <Option name='DERIVED_ACCURACY' type='string-select' description='FAST uses vectorized atan2/log10 approximations for PHASE and DB; EXACT uses libm' default='FAST'>
+                                  <Value>FAST</Value>
+                                  <Value>EXACT</Value>
+                                  </Option>
+                                  <Option name='COMPOSITE' type='string' description='GCOV polarimetric bands computed per block: PAULI (RGB), RVI, SPAN, or RATIO:<term>/<term> (e.g. RATIO:HVHV/HHHH)'/>
+                                  <Option name='MULTILOOK' type='string' description='Return a Float32 layer averaged over AZxRG looks (rows x columns), e.g. 8x2'/>
+                                  <Option name='MULTILOOK_MODE' type='string-select' description='Power-domain average used by MULTILOOK for complex layers' default='INTENSITY'>
+                                  <Value>INTENSITY</Value>
+                                  <Value>AMPLITUDE</Value>
+                                  </Option>
                                   </OpenOptionList>)");
     poDriver->pfnOpen = NisarDataset::Open;
 
@@ -17,24 +17,6 @@
 #include "gdal_version.h"
 #include "gdal.h"  // For CE_Failure etc.
 
-// Define the logic strategy for the mask
-enum class NisarMaskType {
-    GCOV, // Logic: 1-5 Valid; 0, 255 Invalid
-    GUNW  // Logic: Digit parsing (Ref != 0 && Sec != 0)
-};
-
-class NisarHDF5MaskBand final: public GDALRasterBand
-{
-    hid_t m_hMaskDS; 
-    hid_t m_hMaskFileSpaceID; //Cached dataspace handle
-    NisarMaskType m_eType; // Store the logic type
-
-public:
-    NisarHDF5MaskBand(NisarDataset* poDS, hid_t hMaskDS, NisarMaskType eType);
-    virtual ~NisarHDF5MaskBand();
-    virtual CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage) override;
-};
-
 /**
  * Gets the full HDF5 path of an object from its handle (hid_t).
  */
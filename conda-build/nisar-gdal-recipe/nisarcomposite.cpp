@@ -0,0 +1,173 @@
+#include <cstring>
+
+#include "nisarcomposite.h"
+#include "nisarcompositerasterband.h"
+#include "cpl_string.h"
+
+// ====================================================================
+// NisarCompositeDataset Implementation
+// ====================================================================
+
+namespace
+{
+
+// A set of terms to open and the bands computed from them
+struct CompositeRecipe
+{
+    std::vector<std::string> aosTerms;
+    std::vector<NisarCompositeOutput> aoOutputs;
+};
+
+// Candidates in order of preference: quad-pol first, then dual-pol
+std::vector<CompositeRecipe> GetCompositeRecipes(const char* pszComposite)
+{
+    std::vector<CompositeRecipe> aoRecipes;
+    if (EQUAL(pszComposite, "PAULI")) {
+        // Pauli powers |HH-VV|^2/2, 2|HV|^2, |HH+VV|^2/2 need Re(HHVV)
+        aoRecipes.push_back({{"HHHH", "HVHV", "VVVV", "HHVV"},
+                             {{"PAULI_R", {0.5f, 0, 0.5f, -1}, {}},
+                              {"PAULI_G", {0, 2, 0, 0}, {}},
+                              {"PAULI_B", {0.5f, 0, 0.5f, 1}, {}}}});
+        // Diagonal-only products: the usual Pauli-like HHHH/HVHV/VVVV RGB
+        aoRecipes.push_back({{"HHHH", "HVHV", "VVVV"},
+                             {{"HHHH", {1, 0, 0}, {}}, {"HVHV", {0, 1, 0}, {}}, {"VVVV", {0, 0, 1}, {}}}});
+        for (const auto& aosDual : {std::vector<std::string>{"HHHH", "HVHV"}, std::vector<std::string>{"VVVV", "VHVH"}}) {
+            aoRecipes.push_back({aosDual,
+                                 {{aosDual[0], {1, 0}, {}},
+                                  {aosDual[1], {0, 1}, {}},
+                                  {aosDual[0] + "/" + aosDual[1], {1, 0}, {0, 1}}}});
+        }
+    } else if (EQUAL(pszComposite, "RVI")) {
+        aoRecipes.push_back({{"HHHH", "HVHV", "VVVV"}, {{"RVI", {0, 8, 0}, {1, 2, 1}}}});
+        aoRecipes.push_back({{"HHHH", "HVHV"}, {{"RVI", {0, 4}, {1, 1}}}});
+        aoRecipes.push_back({{"VVVV", "VHVH"}, {{"RVI", {0, 4}, {1, 1}}}});
+    } else if (EQUAL(pszComposite, "SPAN")) {
+        aoRecipes.push_back({{"HHHH", "HVHV", "VVVV"}, {{"SPAN", {1, 2, 1}, {}}}});
+        aoRecipes.push_back({{"HHHH", "HVHV"}, {{"SPAN", {1, 1}, {}}}});
+        aoRecipes.push_back({{"VVVV", "VHVH"}, {{"SPAN", {1, 1}, {}}}});
+    } else if (STARTS_WITH_CI(pszComposite, "RATIO:")) {
+        const CPLStringList aosTerms(CSLTokenizeString2(pszComposite + 6, "/", CSLT_STRIPLEADSPACES | CSLT_STRIPENDSPACES));
+        if (aosTerms.size() == 2) {
+            std::string osNum = aosTerms[0], osDen = aosTerms[1];
+            for (auto& c : osNum) c = toupper(c);
+            for (auto& c : osDen) c = toupper(c);
+            aoRecipes.push_back({{osNum, osDen}, {{osNum + "/" + osDen, {1, 0}, {0, 1}}}});
+        }
+    }
+    return aoRecipes;
+}
+
+}  // namespace
+
+NisarCompositeDataset::~NisarCompositeDataset()
+{
+    // Bands read through the source; it goes after them
+    FlushCache(true);
+    if (m_poSrcDS) GDALClose(m_poSrcDS);
+}
+
+#if GDAL_VERSION_MAJOR < 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR < 12)
+CPLErr NisarCompositeDataset::GetGeoTransform(double* padfTransform)
+{
+    return m_poSrcDS->GetGeoTransform(padfTransform);
+}
+#else
+CPLErr NisarCompositeDataset::GetGeoTransform(GDALGeoTransform& gt) const
+{
+    return m_poSrcDS->GetGeoTransform(gt);
+}
+#endif
+
+const OGRSpatialReference* NisarCompositeDataset::GetSpatialRef() const
+{
+    return m_poSrcDS ? m_poSrcDS->GetSpatialRef() : nullptr;
+}
+
+int NisarCompositeDataset::GetGCPCount()
+{
+    return m_poSrcDS ? m_poSrcDS->GetGCPCount() : 0;
+}
+
+const GDAL_GCP* NisarCompositeDataset::GetGCPs()
+{
+    return m_poSrcDS ? m_poSrcDS->GetGCPs() : nullptr;
+}
+
+const OGRSpatialReference* NisarCompositeDataset::GetGCPSpatialRef() const
+{
+    return m_poSrcDS ? m_poSrcDS->GetGCPSpatialRef() : nullptr;
+}
+
+GDALDataset* NisarCompositeDataset::Open(GDALOpenInfo* poOpenInfo)
+{
+    const char* pszComposite = CSLFetchNameValue(poOpenInfo->papszOpenOptions, "COMPOSITE");
+    const std::vector<CompositeRecipe> aoRecipes = GetCompositeRecipes(pszComposite);
+    if (aoRecipes.empty()) {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "NISAR: Invalid COMPOSITE=%s; expected PAULI, RVI, SPAN or RATIO:<term>/<term>.", pszComposite);
+        return nullptr;
+    }
+    if (CSLFetchNameValue(poOpenInfo->papszOpenOptions, "DERIVED") != nullptr) {
+        CPLError(CE_Failure, CPLE_IllegalArg, "NISAR: COMPOSITE cannot be combined with DERIVED.");
+        return nullptr;
+    }
+
+    // The recipe picks the terms: drop POL and COMPOSITE from the source options
+    CPLStringList aosBaseOptions;
+    for (char** papszIter = poOpenInfo->papszOpenOptions; papszIter && *papszIter; ++papszIter) {
+        if (!STARTS_WITH_CI(*papszIter, "COMPOSITE=") && !STARTS_WITH_CI(*papszIter, "POL=")) {
+            aosBaseOptions.AddString(*papszIter);
+        }
+    }
+
+    // First recipe whose terms all exist; only the last failure is reported
+    const char* const apszAllowedDrivers[] = { "NISAR", nullptr };
+    GDALDataset* poSrcDS = nullptr;
+    const CompositeRecipe* poRecipe = nullptr;
+    for (size_t i = 0; i < aoRecipes.size() && poSrcDS == nullptr; i++) {
+        std::string osPol;
+        for (const auto& osTerm : aoRecipes[i].aosTerms) osPol += (osPol.empty() ? "" : ",") + osTerm;
+        CPLStringList aosSrcOptions(aosBaseOptions);
+        aosSrcOptions.SetNameValue("POL", osPol.c_str());
+
+        const bool bLast = (i + 1 == aoRecipes.size());
+        if (!bLast) CPLPushErrorHandler(CPLQuietErrorHandler);
+        poSrcDS = static_cast<GDALDataset*>(GDALOpenEx(poOpenInfo->pszFilename, GDAL_OF_RASTER | GDAL_OF_INTERNAL,
+                                                       apszAllowedDrivers, aosSrcOptions.List(), nullptr));
+        if (!bLast) {
+            CPLPopErrorHandler();
+            CPLErrorReset();
+        }
+        if (poSrcDS) poRecipe = &aoRecipes[i];
+    }
+    if (poSrcDS == nullptr) return nullptr;
+
+    // Covariance powers are real; a complex term contributes its real part
+    if (poSrcDS->GetRasterCount() != static_cast<int>(poRecipe->aosTerms.size()) ||
+        GDALDataTypeIsComplex(poSrcDS->GetRasterBand(1)->GetRasterDataType())) {
+        CPLError(CE_Failure, CPLE_NotSupported, "NISAR: COMPOSITE=%s requires distinct, real GCOV covariance terms.", pszComposite);
+        GDALClose(poSrcDS);
+        return nullptr;
+    }
+
+    NisarCompositeDataset* poDS = new NisarCompositeDataset();
+    poDS->m_poSrcDS = poSrcDS;
+    poDS->m_aoOutputs = poRecipe->aoOutputs;
+    poDS->nRasterXSize = poSrcDS->GetRasterXSize();
+    poDS->nRasterYSize = poSrcDS->GetRasterYSize();
+
+    poDS->SetMetadata(poSrcDS->GetMetadata());
+    std::string osComposite = pszComposite;
+    for (auto& c : osComposite) c = toupper(c);
+    poDS->SetMetadataItem("COMPOSITE", osComposite.c_str());
+
+    for (size_t i = 0; i < poDS->m_aoOutputs.size(); i++) {
+        const int iBand = static_cast<int>(i) + 1;
+        poDS->SetBand(iBand, new NisarCompositeRasterBand(poDS, iBand, static_cast<int>(i)));
+        poDS->GetRasterBand(iBand)->SetDescription(poDS->m_aoOutputs[i].osName.c_str());
+    }
+
+    CPLDebug("NISAR_DRIVER", "Composite: %s from %s | %d bands", osComposite.c_str(),
+             poSrcDS->GetMetadataItem("POLARIZATIONS"), poDS->GetRasterCount());
+    return poDS;
+}
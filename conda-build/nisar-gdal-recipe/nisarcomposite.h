@@ -0,0 +1,60 @@
+#ifndef NISAR_COMPOSITE_H
+#define NISAR_COMPOSITE_H
+
+#include <string>
+#include <vector>
+
+#include "gdal_priv.h"
+#include "ogr_spatialref.h"
+#include "gdal_version.h"
+
+// Compatibility shim for GDAL < 3.12 GeoTransform signature
+#if GDAL_VERSION_MAJOR < 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR < 12)
+    #ifndef USE_LEGACY_GEOTRANSFORM
+    #define USE_LEGACY_GEOTRANSFORM 1
+    #endif
+#endif
+
+class NisarCompositeRasterBand;
+
+// One output band: weighted sum of the source terms, optionally divided
+// by a second weighted sum (weights indexed like the source bands)
+struct NisarCompositeOutput
+{
+    std::string osName;
+    std::vector<float> afNum;
+    std::vector<float> afDen;  // Empty: no division
+};
+
+// ====================================================================
+// NisarCompositeDataset
+// COMPOSITE=PAULI|RVI|SPAN|RATIO:A/B: Float32 polarimetric bands
+// evaluated per block from GCOV covariance terms. Only the terms the
+// composite needs are opened (one POL list), so they share one fetch.
+// ====================================================================
+class NisarCompositeDataset final : public GDALDataset
+{
+    friend class NisarCompositeRasterBand;
+
+private:
+    GDALDataset* m_poSrcDS = nullptr; // One band per needed term
+    std::vector<NisarCompositeOutput> m_aoOutputs;
+
+public:
+    NisarCompositeDataset() = default;
+    ~NisarCompositeDataset() override;
+
+    static GDALDataset* Open(GDALOpenInfo* poOpenInfo);
+
+    const OGRSpatialReference* GetSpatialRef() const override;
+    int GetGCPCount() override;
+    const GDAL_GCP* GetGCPs() override;
+    const OGRSpatialReference* GetGCPSpatialRef() const override;
+
+#ifdef USE_LEGACY_GEOTRANSFORM
+    CPLErr GetGeoTransform( double * padfTransform ) override;
+#else
+    CPLErr GetGeoTransform(GDALGeoTransform &gt) const override;
+#endif
+};
+#endif // NISAR_COMPOSITE_H
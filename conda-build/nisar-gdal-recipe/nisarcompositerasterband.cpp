@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "nisarcompositerasterband.h"
+#include "nisarcomposite.h"
+#include "nisarderived.h"
+
+// ====================================================================
+// NisarCompositeRasterBand Implementation
+// ====================================================================
+
+NisarCompositeRasterBand::NisarCompositeRasterBand(NisarCompositeDataset* poDSIn, int nBandIn, int iOutput)
+    : m_iOutput(iOutput)
+{
+    this->poDS = poDSIn;
+    this->nBand = nBandIn;
+    this->eDataType = GDT_Float32;
+
+    // Same grid as the terms, so one composite block is one block per term
+    poDSIn->m_poSrcDS->GetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+}
+
+double NisarCompositeRasterBand::GetNoDataValue(int* pbSuccess)
+{
+    if (pbSuccess) *pbSuccess = TRUE;
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+// MASK=YES: the layer mask of the terms applies unchanged
+GDALRasterBand* NisarCompositeRasterBand::GetMaskBand()
+{
+    GDALRasterBand* poSrcBand = static_cast<NisarCompositeDataset*>(poDS)->m_poSrcDS->GetRasterBand(1);
+    if (poSrcBand->GetMaskFlags() == GMF_PER_DATASET) return poSrcBand->GetMaskBand();
+    return GDALRasterBand::GetMaskBand();
+}
+
+int NisarCompositeRasterBand::GetMaskFlags()
+{
+    GDALRasterBand* poSrcBand = static_cast<NisarCompositeDataset*>(poDS)->m_poSrcDS->GetRasterBand(1);
+    if (poSrcBand->GetMaskFlags() == GMF_PER_DATASET) return GMF_PER_DATASET;
+    return GDALRasterBand::GetMaskFlags();
+}
+
+CPLErr NisarCompositeRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void* pImage)
+{
+    auto t_start = std::chrono::high_resolution_clock::now();
+
+    NisarCompositeDataset* poGDS = static_cast<NisarCompositeDataset*>(poDS);
+    const NisarCompositeOutput& oOutput = poGDS->m_aoOutputs[m_iOutput];
+    const int nTerms = static_cast<int>(oOutput.afNum.size());
+    float* pafOutput = static_cast<float*>(pImage);
+
+    const int nXOff = nBlockXOff * nBlockXSize;
+    const int nYOff = nBlockYOff * nBlockYSize;
+    const int nReqXSize = std::min(nBlockXSize, nRasterXSize - nXOff);
+    const int nReqYSize = std::min(nBlockYSize, nRasterYSize - nYOff);
+    const size_t nPixels = static_cast<size_t>(nBlockXSize) * nBlockYSize;
+
+    // Terms laid out like the output block; unweighted ones are never read
+    std::vector<std::vector<float>> aafTerms(nTerms);
+    std::vector<const float*> apafTerms(nTerms, nullptr);
+    for (int k = 0; k < nTerms; k++) {
+        if (oOutput.afNum[k] == 0 && (oOutput.afDen.empty() || oOutput.afDen[k] == 0)) continue;
+        aafTerms[k].assign(nPixels, std::numeric_limits<float>::quiet_NaN());
+        apafTerms[k] = aafTerms[k].data();
+
+        // Complex terms (HHVV) are read as their real part
+        GDALRasterBand* poSrcBand = poGDS->m_poSrcDS->GetRasterBand(k + 1);
+        CPLErr eErr = poSrcBand->RasterIO(GF_Read, nXOff, nYOff, nReqXSize, nReqYSize, aafTerms[k].data(),
+                                          nReqXSize, nReqYSize, GDT_Float32, sizeof(float),
+                                          static_cast<GSpacing>(sizeof(float)) * nBlockXSize, nullptr);
+        if (eErr != CE_None) return eErr;
+
+        // A non-NaN fill becomes NaN so that it propagates through the kernel
+        int bHasNoData = FALSE;
+        const double dfNoData = poSrcBand->GetNoDataValue(&bHasNoData);
+        if (bHasNoData && !std::isnan(dfNoData)) {
+            const float fNoData = static_cast<float>(dfNoData);
+            for (float& f : aafTerms[k]) {
+                if (f == fNoData) f = std::numeric_limits<float>::quiet_NaN();
+            }
+        }
+    }
+
+    NisarDerived::Combine(apafTerms.data(), nTerms, oOutput.afNum.data(),
+                          oOutput.afDen.empty() ? nullptr : oOutput.afDen.data(), nPixels, pafOutput);
+
+    std::chrono::duration<double, std::milli> t_diff = std::chrono::high_resolution_clock::now() - t_start;
+    CPLDebug("NISAR_DRIVER", "Composite Block(X:%d, Y:%d) | %s | Time: %.3f ms",
+             nBlockXOff, nBlockYOff, oOutput.osName.c_str(), t_diff.count());
+    return CE_None;
+}
@@ -0,0 +1,30 @@
+#ifndef NISAR_COMPOSITE_RASTERBAND_H
+#define NISAR_COMPOSITE_RASTERBAND_H
+
+#include "gdal_priv.h"
+
+// Forward declare the dataset so the band knows it exists
+class NisarCompositeDataset;
+
+// ====================================================================
+// NisarCompositeRasterBand
+// Reads the block of every weighted term and combines them. The first
+// term read co-fetches the others into their own block caches.
+// ====================================================================
+class NisarCompositeRasterBand final : public GDALRasterBand
+{
+    friend class NisarCompositeDataset;
+
+    int m_iOutput = 0;
+
+public:
+    NisarCompositeRasterBand(NisarCompositeDataset* poDSIn, int nBandIn, int iOutput);
+    ~NisarCompositeRasterBand() override = default;
+
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void* pImage) override;
+    double GetNoDataValue(int* pbSuccess = nullptr) override;
+    GDALRasterBand* GetMaskBand() override;
+    int GetMaskFlags() override;
+};
+
+#endif // NISAR_COMPOSITE_RASTERBAND_H
@@ -13,6 +13,8 @@
 #include "nisardataset.h"
 #include "nisarrasterband.h"
 #include "nisarinterpolated.h"
+#include "nisarmultilook.h"
+#include "nisarcomposite.h"
 
 #include <sstream>  // For std::ostringstream
 #include <iomanip>  // For std::setprecision
@@ -20,6 +22,14 @@
 #include <string>
 #include <algorithm>
 #include <thread>
+#include <cmath>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 
 #include "cpl_port.h"
@@ -1238,12 +1248,22 @@ NisarDataset::~NisarDataset()
     // Flush PAM cache first
     FlushCache(true);
 
+    // Mask bands hold blocks in the cache and their own HDF5 handles
+    for (NisarRasterBand* poMask : m_apoLayerMasks) delete poMask;
+    m_apoLayerMasks.clear();
+
     // Destroy the subdataset list if it exists
     // CSLDestroy handles NULL input safely.
     CSLDestroy(papszSubDatasets);
     papszSubDatasets = nullptr;  // nullify after destroy
 
     // Close HDF5 handles if they are valid
+    for (size_t i = 1; i < m_ahPolDatasets.size(); i++)
+    {
+        if (m_ahPolDatasets[i] >= 0) H5Dclose(m_ahPolDatasets[i]);
+    }
+    m_ahPolDatasets.clear();
+
     if (hDataset >= 0)
     {
         H5Dclose(hDataset);
@@ -1270,6 +1290,202 @@ NisarDataset::~NisarDataset()
     // Clean up Metadata caches
     CSLDestroy(m_papszGlobalMetadata);  // Destroy global metadata list
     m_papszGlobalMetadata = nullptr;
+
+#ifndef _WIN32
+    if (m_pMapBase != nullptr)
+    {
+        munmap(m_pMapBase, m_nMapSize);
+        m_pMapBase = nullptr;
+    }
+#endif
+}
+
+/************************************************************************/
+/*                       GetSyntheticBlockSize()                        */
+/* Logical GDAL block for a layer chunked nChunkX x nChunkY: an aligned  */
+/* group of whole chunks. BLOCK_SIZE is rounded to the nearest chunk     */
+/* multiple and takes precedence over BLOCK_MULTIPLE. Neither grows a    */
+/* block past the chunk-rounded raster extent.                           */
+/************************************************************************/
+void NisarDataset::GetSyntheticBlockSize(int nChunkX, int nChunkY, int nXSize, int nYSize,
+                                         int *pnBlockX, int *pnBlockY) const
+{
+    int nMultX = m_nBlockMultipleX;
+    int nMultY = m_nBlockMultipleY;
+    if (m_nRequestedBlockXSize > 0 && m_nRequestedBlockYSize > 0)
+    {
+        nMultX = std::max(1, (m_nRequestedBlockXSize + nChunkX / 2) / nChunkX);
+        nMultY = std::max(1, (m_nRequestedBlockYSize + nChunkY / 2) / nChunkY);
+    }
+    nMultX = std::min(nMultX, std::max(1, (nXSize + nChunkX - 1) / nChunkX));
+    nMultY = std::min(nMultY, std::max(1, (nYSize + nChunkY - 1) / nChunkY));
+
+    *pnBlockX = nChunkX * nMultX;
+    *pnBlockY = nChunkY * nMultY;
+}
+
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 7)
+/************************************************************************/
+/*                        GetCompressionFormats()                       */
+/* A single-band window that is exactly one stored chunk can be handed */
+/* out as its compressed bytes (see NisarRasterBand::GetChunkForWindow) */
+/************************************************************************/
+CPLStringList NisarDataset::GetCompressionFormats(int nXOff, int nYOff, int nXSize, int nYSize,
+                                                  int nBandCount, const int *panBandList)
+{
+    CPLStringList aosFormats;
+    const int nBandIdx = (nBandCount == 1) ? (panBandList ? panBandList[0] : 1) : (nBands == 1 ? 1 : 0);
+    if (nBandIdx < 1 || nBandIdx > nBands || (nBandCount != 1 && nBands != 1)) return aosFormats;
+
+    auto poBand = static_cast<NisarRasterBand *>(GetRasterBand(nBandIdx));
+    if (!poBand->GetChunkForWindow(nXOff, nYOff, nXSize, nYSize)) return aosFormats;
+
+    const std::string osFormat = poBand->GetCompressedChunkFormat();
+    if (!osFormat.empty()) aosFormats.AddString(osFormat.c_str());
+    return aosFormats;
+}
+
+/************************************************************************/
+/*                         ReadCompressedData()                         */
+/************************************************************************/
+CPLErr NisarDataset::ReadCompressedData(const char *pszFormat, int nXOff, int nYOff, int nXSize,
+                                        int nYSize, int nBandCount, const int *panBandList,
+                                        void **ppBuffer, size_t *pnBufferSize,
+                                        char **ppszDetailedFormat)
+{
+    const int nBandIdx = (nBandCount == 1) ? (panBandList ? panBandList[0] : 1) : (nBands == 1 ? 1 : 0);
+    if (nBandIdx < 1 || nBandIdx > nBands || (nBandCount != 1 && nBands != 1)) return CE_Failure;
+
+    auto poBand = static_cast<NisarRasterBand *>(GetRasterBand(nBandIdx));
+    const auto *poChunk = poBand->GetChunkForWindow(nXOff, nYOff, nXSize, nYSize);
+    const std::string osFormat = poBand->GetCompressedChunkFormat();
+    if (!poChunk || osFormat.empty()) return CE_Failure;
+
+    // Only the codec name has to match: "DEFLATE" or the full detailed string
+    const CPLStringList aosRequested(CSLTokenizeString2(pszFormat, ";", 0));
+    const CPLStringList aosServed(CSLTokenizeString2(osFormat.c_str(), ";", 0));
+    if (aosRequested.size() == 0 || !EQUAL(aosRequested[0], aosServed[0])) return CE_Failure;
+
+    // The trailing Fletcher-32 checksum is not part of the codec stream
+    size_t nSize = poChunk->nLength;
+    for (const auto &oStep : poBand->m_oFilters.GetSteps()) {
+        if (oStep.nId == H5Z_FILTER_FLETCHER32 && nSize >= 4) nSize -= 4;
+    }
+
+    // The detailed format is only handed out on success
+    if (!ppBuffer) {
+        if (pnBufferSize) *pnBufferSize = nSize;
+        if (ppszDetailedFormat) *ppszDetailedFormat = VSIStrdup(osFormat.c_str());
+        return CE_None;
+    }
+    if (!pnBufferSize) return CE_Failure;
+
+    bool bFreeOnError = false;
+    if (*ppBuffer) {
+        if (*pnBufferSize < nSize) {
+            CPLError(CE_Failure, CPLE_AppDefined, "NISAR: Compressed chunk needs %zu bytes, buffer has %zu.",
+                     nSize, *pnBufferSize);
+            return CE_Failure;
+        }
+    } else {
+        *ppBuffer = VSI_MALLOC_VERBOSE(nSize);
+        if (!*ppBuffer) return CE_Failure;
+        bFreeOnError = true;
+    }
+    *pnBufferSize = nSize;
+
+    const std::string sRawPath = poBand->GetRawVSIPath();
+    size_t nMapSize = 0;
+    const GByte *pMappedBase = GetMappedFile(sRawPath, &nMapSize);
+    bool bOK = false;
+    if (pMappedBase && poChunk->nOffset + nSize <= nMapSize) {
+        memcpy(*ppBuffer, pMappedBase + poChunk->nOffset, nSize);
+        bOK = true;
+    } else if (VSILFILE *fp = VSIFOpenL(sRawPath.c_str(), "rb")) {
+        bOK = VSIFSeekL(fp, poChunk->nOffset, SEEK_SET) == 0 && VSIFReadL(*ppBuffer, 1, nSize, fp) == nSize;
+        VSIFCloseL(fp);
+    }
+    if (!bOK) {
+        CPLError(CE_Failure, CPLE_FileIO, "NISAR: Failed to read compressed chunk at offset " CPL_FRMT_GUIB ".",
+                 static_cast<GUIntBig>(poChunk->nOffset));
+        if (bFreeOnError) {
+            VSIFree(*ppBuffer);
+            *ppBuffer = nullptr;
+        }
+        return CE_Failure;
+    }
+    if (ppszDetailedFormat) *ppszDetailedFormat = VSIStrdup(osFormat.c_str());
+    return CE_None;
+}
+#endif
+
+/************************************************************************/
+/*                           GetMappedFile()                            */
+/* Maps a local granule read-only, once per dataset, so chunk bytes can */
+/* be handed to the decoder without a VSIFReadL copy. Remote (/vsi*)    */
+/* paths, Windows builds and NISAR_USE_MMAP=NO return nullptr and the   */
+/* caller falls back to VSI reads.                                      */
+/************************************************************************/
+const GByte *NisarDataset::GetMappedFile(const std::string &sRawPath, size_t *pnMapSize)
+{
+#ifndef _WIN32
+    std::lock_guard<std::mutex> oLock(m_oMapMutex);
+    if (!m_bMapAttempted)
+    {
+        m_bMapAttempted = true;
+        if (!STARTS_WITH_CI(sRawPath.c_str(), "/vsi") &&
+            CPLTestBool(CPLGetConfigOption("NISAR_USE_MMAP", "YES")))
+        {
+            int fd = open(sRawPath.c_str(), O_RDONLY);
+            struct stat sStat;
+            if (fd >= 0 && fstat(fd, &sStat) == 0 && sStat.st_size > 0)
+            {
+                void *pBase = mmap(nullptr, static_cast<size_t>(sStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+                if (pBase != MAP_FAILED)
+                {
+                    m_pMapBase = pBase;
+                    m_nMapSize = static_cast<size_t>(sStat.st_size);
+
+                    // Single-block reads are random access: stop the kernel
+                    // from reading ahead pages that belong to other chunks.
+                    if (atoi(CPLGetConfigOption("NISAR_PREFETCH_GRID", "1")) <= 1)
+                        madvise(m_pMapBase, m_nMapSize, MADV_RANDOM);
+
+                    CPLDebug("NISAR_DRIVER", "Memory-mapped %s (%zu bytes)", sRawPath.c_str(), m_nMapSize);
+                }
+            }
+            if (fd >= 0) close(fd);  // The mapping keeps its own reference
+        }
+    }
+    if (m_pMapBase)
+    {
+        *pnMapSize = m_nMapSize;
+        return static_cast<const GByte *>(m_pMapBase);
+    }
+#else
+    (void)sRawPath;
+#endif
+    *pnMapSize = 0;
+    return nullptr;
+}
+
+/************************************************************************/
+/*                         AdviseMappedRange()                          */
+/* Asks the kernel to start paging in a byte range the prefetch plan    */
+/* is about to decode.                                                  */
+/************************************************************************/
+void NisarDataset::AdviseMappedRange(vsi_l_offset nOffset, size_t nSize)
+{
+#ifndef _WIN32
+    if (!m_pMapBase || nSize == 0 || nOffset >= m_nMapSize) return;
+    static const size_t nPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t nStart = static_cast<size_t>(nOffset) & ~(nPageSize - 1);
+    const size_t nEnd = std::min(m_nMapSize, static_cast<size_t>(nOffset) + nSize);
+    madvise(static_cast<GByte *>(m_pMapBase) + nStart, nEnd - nStart, MADV_WILLNEED);
+#else
+    (void)nOffset;
+    (void)nSize;
+#endif
 }
 
 /**
@@ -2271,6 +2487,109 @@ void NisarDataset::LoadMetadataDomain(const std::string& sKeyword)
     H5Gclose(hGroup);
 }
 
+/************************************************************************/
+/*                      DiscoverFileSpacePageSize()                     */
+/* Opens the file once without a page buffer and reads the file-space   */
+/* strategy from the creation property list. Returns the page size when */
+/* the file was written with paged aggregation, 0 otherwise.            */
+/************************************************************************/
+static hsize_t DiscoverFileSpacePageSize(const char *pszFilename, hid_t hFapl)
+{
+    hsize_t nPageSize = 0;
+
+    H5E_auto2_t old_func; void *old_client_data;
+    H5Eget_auto2(H5E_DEFAULT, &old_func, &old_client_data);
+    H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+
+    hid_t hFile = H5Fopen(pszFilename, H5F_ACC_RDONLY, hFapl);
+    if (hFile >= 0) {
+        hid_t hFcpl = H5Fget_create_plist(hFile);
+        if (hFcpl >= 0) {
+            H5F_fspace_strategy_t eStrategy = H5F_FSPACE_STRATEGY_FSM_AGGR;
+            hbool_t bPersist = false;
+            hsize_t nThreshold = 0;
+            if (H5Pget_file_space_strategy(hFcpl, &eStrategy, &bPersist, &nThreshold) >= 0 &&
+                eStrategy == H5F_FSPACE_STRATEGY_PAGE) {
+                H5Pget_file_space_page_size(hFcpl, &nPageSize);
+            }
+            H5Pclose(hFcpl);
+        }
+        H5Fclose(hFile);
+    }
+
+    H5Eset_auto2(H5E_DEFAULT, old_func, old_client_data);
+    return nPageSize;
+}
+
+/************************************************************************/
+/*                          ComputeChunkCache()                         */
+/* Sizes the HDF5 raw data chunk cache from the dataset's chunk shape.  */
+/* Layers served by the direct-chunk path (DEFLATE/SHUFFLE only) only   */
+/* need one row of chunks as a safety net for incidental H5Dread calls. */
+/* Layers that go through H5Dread get two rows so a row-major scan      */
+/* never evicts a chunk it is about to revisit.                         */
+/************************************************************************/
+static void ComputeChunkCache(hid_t hHDF5, const char *pszPath,
+                              size_t &nCacheBytes, size_t &nCacheSlots)
+{
+    nCacheBytes = static_cast<size_t>(NISAR_DEFAULT_CHUNK_CACHE_MB) * 1024 * 1024;
+    nCacheSlots = NISAR_DEFAULT_CHUNK_CACHE_SLOTS;
+
+    H5E_auto2_t old_func; void *old_client_data;
+    H5Eget_auto2(H5E_DEFAULT, &old_func, &old_client_data);
+    H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+
+    hid_t hDset = H5Dopen2(hHDF5, pszPath, H5P_DEFAULT);
+    H5Eset_auto2(H5E_DEFAULT, old_func, old_client_data);
+    if (hDset < 0) return;
+
+    hid_t hDcpl = H5Dget_create_plist(hDset);
+    hid_t hSpace = H5Dget_space(hDset);
+    hid_t hType = H5Dget_type(hDset);
+
+    if (hDcpl >= 0 && hSpace >= 0 && hType >= 0 && H5Pget_layout(hDcpl) == H5D_CHUNKED) {
+        const int nRank = H5Sget_simple_extent_ndims(hSpace);
+        if (nRank >= 2) {
+            std::vector<hsize_t> anDims(nRank), anChunk(nRank);
+            H5Sget_simple_extent_dims(hSpace, anDims.data(), nullptr);
+            if (H5Pget_chunk(hDcpl, nRank, anChunk.data()) == nRank) {
+                size_t nChunkBytes = H5Tget_size(hType);
+                for (int i = 0; i < nRank; i++) nChunkBytes *= static_cast<size_t>(anChunk[i]);
+
+                const size_t nChunksPerRow = static_cast<size_t>(
+                    (anDims[nRank - 1] + anChunk[nRank - 1] - 1) / anChunk[nRank - 1]);
+
+                // Same test as the band: natively decoded pipelines bypass HDF5
+                NisarFilters::FilterPipeline oFilters;
+                oFilters.Build(hDcpl);
+                const bool bDirectChunk = oFilters.IsNative();
+
+                const size_t nRows = bDirectChunk ? 1 : 2;
+                nCacheBytes = std::min(nCacheBytes, std::max<size_t>(nChunkBytes, nChunkBytes * nChunksPerRow * nRows));
+
+                // Slots: a prime roughly 100x the number of chunks that fit
+                size_t nTarget = std::max<size_t>(nCacheBytes / std::max<size_t>(nChunkBytes, 1), 1) * 100;
+                nTarget = std::min<size_t>(nTarget, NISAR_DEFAULT_CHUNK_CACHE_SLOTS);
+                auto IsPrime = [](size_t n) {
+                    if (n < 2) return false;
+                    for (size_t d = 2; d * d <= n; d++) if (n % d == 0) return false;
+                    return true;
+                };
+                while (!IsPrime(nTarget)) nTarget++;
+                nCacheSlots = nTarget;
+
+                CPLDebug("NISAR_DRIVER", "Chunk cache sizing: chunk=%zu bytes, %zu chunks/row, %s path",
+                         nChunkBytes, nChunksPerRow, bDirectChunk ? "direct-chunk" : "H5Dread");
+            }
+        }
+    }
+
+    if (hType >= 0) H5Tclose(hType);
+    if (hSpace >= 0) H5Sclose(hSpace);
+    if (hDcpl >= 0) H5Pclose(hDcpl);
+    H5Dclose(hDset);
+}
+
 /************************************************************************/
 /*                                Open()                                */
 /* This static method is responsible for opening a NISAR HDF5 file and  */
@@ -2302,6 +2621,22 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
         return NisarInterpolatedDataset::Open(poOpenInfo);
     }       
 
+    // MULTILOOK=AZxRG: reopen the layer without it and wrap it
+    if (poOpenInfo->papszOpenOptions != nullptr &&
+        CSLFetchNameValue(poOpenInfo->papszOpenOptions, "MULTILOOK") != nullptr)
+    {
+        CPLDebug("NISAR_DRIVER", "MULTILOOK option detected. Routing to NisarMultilookDataset.");
+        return NisarMultilookDataset::Open(poOpenInfo);
+    }
+
+    // COMPOSITE=...: open the needed covariance terms and combine them
+    if (poOpenInfo->papszOpenOptions != nullptr &&
+        CSLFetchNameValue(poOpenInfo->papszOpenOptions, "COMPOSITE") != nullptr)
+    {
+        CPLDebug("NISAR_DRIVER", "COMPOSITE option detected. Routing to NisarCompositeDataset.");
+        return NisarCompositeDataset::Open(poOpenInfo);
+    }
+
     // ====================================================================
     // PATH PARSING
     // ====================================================================
@@ -2378,6 +2713,13 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
 
     const char* filenameForH5Fopen = osNormalizedPath.c_str();
 
+    // ====================================================================
+    // OPEN FOOTPRINT (Record / replay HDF5 metadata reads for this open)
+    // ====================================================================
+    // Scoped to the whole of Open() so the B-tree walk done by the band
+    // constructors is captured too. No-op unless NISAR_OPEN_FOOTPRINT_CACHE is set.
+    NisarVFL::OpenFootprintScope oFootprintScope;
+
     // ====================================================================
     // VIRTUAL FILE LAYER (VFL) ROUTING
     // ====================================================================
@@ -2400,25 +2742,76 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
     }
 
     // ====================================================================
-    // PAGE BUFFERING (Hardcoded 4 MiB)
+    // PAGE BUFFERING
     // ====================================================================
-    size_t nPageBufferSize = 4 * 1024 * 1024; // 4 MiB
-    if (H5Pset_page_buffer_size(fapl_id_base, nPageBufferSize, 0, 0) < 0) {
-        CPLDebug("NISAR_DRIVER", "Warning: Failed to set HDF5 Page Buffer Size.");
-    } else {
-        CPLDebug("NISAR_DRIVER", "Set HDF5 FAPL page buffer to 4 MiB.");
+    // ENABLE_PAGE_BUFFERING=YES: discover the file-space strategy first and
+    // size the buffer as page_size x PAGE_BUFFER_COUNT. HDF5 refuses to open
+    // files without paged aggregation when a page buffer is set, so
+    // non-paged files are opened without one.
+    // ENABLE_PAGE_BUFFERING=NO: speculative single NISAR_DEFAULT_PAGE_SIZE
+    // buffer, retried without page buffering if the file is not paged.
+    const bool bDiscoverPaging = CPLFetchBool(poOpenInfo->papszOpenOptions, "ENABLE_PAGE_BUFFERING", false);
+    const int nPageCount = std::max(1, atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "PAGE_BUFFER_COUNT",
+                                                                 CPLSPrintf("%d", NISAR_DEFAULT_PAGE_COUNT))));
+    const char *pszPageBufferMB = CSLFetchNameValue(poOpenInfo->papszOpenOptions, "PAGE_BUFFER_SIZE_MB");
+
+    hsize_t nFileSpacePageSize = 0;
+    size_t nPageBufferSize = NISAR_DEFAULT_PAGE_SIZE;
+
+    if (bDiscoverPaging) {
+        nFileSpacePageSize = DiscoverFileSpacePageSize(filenameForH5Fopen, fapl_id_base);
+        nPageBufferSize = nFileSpacePageSize > 0 ? static_cast<size_t>(nFileSpacePageSize) * nPageCount : 0;
+        CPLDebug("NISAR_DRIVER", "Page discovery: file-space page size %llu bytes (%s)",
+                 static_cast<unsigned long long>(nFileSpacePageSize),
+                 nFileSpacePageSize > 0 ? "paged aggregation" : "not paged");
+    }
+    if (pszPageBufferMB != nullptr) {
+        nPageBufferSize = static_cast<size_t>(std::max(0, atoi(pszPageBufferMB))) * 1024 * 1024;
+    }
+    // HDF5 requires the buffer to hold at least one page
+    if (nFileSpacePageSize > 0 && nPageBufferSize > 0 && nPageBufferSize < nFileSpacePageSize) {
+        nPageBufferSize = static_cast<size_t>(nFileSpacePageSize);
+    }
+
+    hid_t fapl_id_paged = -1;
+    if (nPageBufferSize > 0) {
+        fapl_id_paged = H5Pcopy(fapl_id_base);
+        if (fapl_id_paged >= 0 && H5Pset_page_buffer_size(fapl_id_paged, nPageBufferSize, 0, 0) < 0) {
+            CPLDebug("NISAR_DRIVER", "Warning: Failed to set HDF5 Page Buffer Size.");
+            H5Pclose(fapl_id_paged);
+            fapl_id_paged = -1;
+        }
     }
 
     // ====================================================================
     // FINAL FILE OPEN
     // ====================================================================
-    CPLDebug("NISAR_DRIVER", "Attempting H5Fopen with optimized FAPL.");
-    hid_t hHDF5 = H5Fopen(filenameForH5Fopen, H5F_ACC_RDONLY, fapl_id_base);
+    hid_t hHDF5 = -1;
+    if (fapl_id_paged >= 0) {
+        CPLDebug("NISAR_DRIVER", "Attempting H5Fopen with %.1f MiB page buffer.",
+                 nPageBufferSize / (1024.0 * 1024.0));
+        H5E_auto2_t old_func_open; void *old_client_data_open;
+        H5Eget_auto2(H5E_DEFAULT, &old_func_open, &old_client_data_open);
+        H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+        hHDF5 = H5Fopen(filenameForH5Fopen, H5F_ACC_RDONLY, fapl_id_paged);
+        H5Eset_auto2(H5E_DEFAULT, old_func_open, old_client_data_open);
+        H5Pclose(fapl_id_paged);
+
+        if (hHDF5 < 0) {
+            CPLDebug("NISAR_DRIVER", "Page-buffered open failed (file not paged?). Retrying without page buffer.");
+            nPageBufferSize = 0;
+        }
+    } else {
+        nPageBufferSize = 0;
+    }
+    if (hHDF5 < 0) {
+        hHDF5 = H5Fopen(filenameForH5Fopen, H5F_ACC_RDONLY, fapl_id_base);
+    }
 
     if (bNeedToCloseFaplBase) H5Pclose(fapl_id_base);
 
     if (hHDF5 < 0) {
-        CPLError(CE_Failure, CPLE_OpenFailed, "H5Fopen failed for '%s'. Ensure metadata fits in 8MiB.", pszActualFilename);
+        CPLError(CE_Failure, CPLE_OpenFailed, "H5Fopen failed for '%s'.", pszActualFilename);
         CPLFree(pszActualFilename);
         return nullptr;
     }
@@ -2440,6 +2833,23 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
     if (pszMaskOpt && CPLTestBool(pszMaskOpt)) {
         poDS->m_bMaskEnabled = true;
     }
+    poDS->m_bApplyMask = CPLTestBool(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "APPLY_MASK", "NO"));
+    poDS->m_sScanOrder = CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "SCAN_ORDER", "AUTO");
+
+    // Synthetic blocks: "4" or "4x2" chunks per block, or a target size in pixels
+    if (const char* pszMultiple = CSLFetchNameValue(poOpenInfo->papszOpenOptions, "BLOCK_MULTIPLE")) {
+        int nMX = 1, nMY = 0;
+        if (sscanf(pszMultiple, "%dx%d", &nMX, &nMY) < 2) nMY = nMX;
+        poDS->m_nBlockMultipleX = std::max(1, nMX);
+        poDS->m_nBlockMultipleY = std::max(1, nMY);
+    }
+    if (const char* pszBlockSize = CSLFetchNameValue(poOpenInfo->papszOpenOptions, "BLOCK_SIZE")) {
+        int nBX = 0, nBY = 0;
+        if (sscanf(pszBlockSize, "%dx%d", &nBX, &nBY) < 2) nBY = nBX;
+        poDS->m_nRequestedBlockXSize = std::max(0, nBX);
+        poDS->m_nRequestedBlockYSize = std::max(0, nBY);
+    }
+    poDS->m_nStripHeight = std::max(0, atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "STRIP_HEIGHT", "0")));
 
     poDS->hHDF5 = hHDF5;
     poDS->pszFilename = pszActualFilename;
@@ -2497,7 +2907,6 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
                 if (pszPol == nullptr) pszPol = "HH";
             }
 
-            std::string sPolUpper = pszPol; for(auto& c : sPolUpper) c = toupper(c);
             std::string sPolList;
             
             H5E_auto2_t old_func_md; void *old_client_data_md;
@@ -2519,14 +2928,24 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
                 delete poDS; return nullptr;
             }
 
-            char **papszPolList = CSLTokenizeString2(sPolList.c_str(), ",", CSLT_STRIPLEADSPACES | CSLT_STRIPENDSPACES);
-            bool bPolFound = false;
-            for (int i = 0; papszPolList && papszPolList[i] != nullptr; ++i) {
-                if (EQUAL(papszPolList[i], pszPol)) { bPolFound = true; break; }
+            // POL=ALL or "HHHH,HVHV,VVVV": one band per term, in the requested order
+            CPLStringList aosPolList(CSLTokenizeString2(sPolList.c_str(), ",", CSLT_STRIPLEADSPACES | CSLT_STRIPENDSPACES));
+            const CPLStringList aosRequested(EQUAL(pszPol, "ALL") ? CSLDuplicate(aosPolList.List())
+                                             : CSLTokenizeString2(pszPol, ",", CSLT_STRIPLEADSPACES | CSLT_STRIPENDSPACES));
+            std::vector<std::string> aosTerms;
+            for (int iReq = 0; iReq < aosRequested.size(); ++iReq) {
+                bool bPolFound = false;
+                for (int i = 0; i < aosPolList.size(); ++i) {
+                    if (EQUAL(aosPolList[i], aosRequested[iReq])) { bPolFound = true; break; }
+                }
+                if (!bPolFound) {
+                    CPLError(CE_Failure, CPLE_OpenFailed, "Invalid POL open option: '%s'.", aosRequested[iReq]);
+                    delete poDS; return nullptr;
+                }
+                std::string sTerm = aosRequested[iReq]; for (auto& c : sTerm) c = toupper(c);
+                if (std::find(aosTerms.begin(), aosTerms.end(), sTerm) == aosTerms.end()) aosTerms.push_back(sTerm);
             }
-            CSLDestroy(papszPolList);
-
-            if (!bPolFound) {
+            if (aosTerms.empty()) {
                 CPLError(CE_Failure, CPLE_OpenFailed, "Invalid POL open option: '%s'.", pszPol);
                 delete poDS; return nullptr;
             }
@@ -2534,8 +2953,9 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
             poDS->m_sInst = pszInst;
             poDS->m_sFreq = pszFreq;
             poDS->m_sPol = pszPol;
+            if (aosTerms.size() > 1) poDS->m_aosPolTerms = aosTerms;
 
-            sConstructedPath = sMetadataGroupPath + "/" + sPolUpper;
+            sConstructedPath = sMetadataGroupPath + "/" + aosTerms[0];
             pathToOpen = sConstructedPath.c_str();
         } else {
             // Container dataset discovery
@@ -2613,19 +3033,35 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
     }
 
     // ====================================================================
-    // DAPL & CHUNK CACHE (Targeting 512x512)
+    // DAPL & CHUNK CACHE (Sized from the chunk shape, overridable)
     // ====================================================================
     hid_t dapl_id = H5Pcreate(H5P_DATASET_ACCESS);
     bool bNeedToCloseDapl = (dapl_id >= 0);
 
+    size_t nCacheSizeBytes = 0;
+    size_t nCacheSlots = 0;
+    ComputeChunkCache(poDS->hHDF5, pathToOpen, nCacheSizeBytes, nCacheSlots);
+
+    const char *pszCacheMB = CSLFetchNameValue(poOpenInfo->papszOpenOptions, "CHUNK_CACHE_MB");
+    const char *pszCacheSlots = CSLFetchNameValue(poOpenInfo->papszOpenOptions, "CHUNK_CACHE_SLOTS");
+    if (pszCacheMB) nCacheSizeBytes = static_cast<size_t>(std::max(0, atoi(pszCacheMB))) * 1024 * 1024;
+    if (pszCacheSlots) nCacheSlots = static_cast<size_t>(std::max(1, atoi(pszCacheSlots)));
+
     if (dapl_id >= 0) {
-        // Since IReadBlock bypasses HDF5 pixel reads entirely, this cache is 
-        // essentially a safety net for any incidental chunk scans.
-        size_t nCacheSlots = 521; // Prime number of slots for 512x512 tiles
-        size_t nCacheSizeBytes = 8 * 1024 * 1024; // 8 MiB dataset cache
         H5Pset_chunk_cache(dapl_id, nCacheSlots, nCacheSizeBytes, 0.75);
     }
 
+    // Report the effective I/O settings
+    poDS->SetMetadataItem("PAGE_BUFFERING", nPageBufferSize > 0 ? "YES" : "NO", "NISAR_IO");
+    poDS->SetMetadataItem("FILE_SPACE_PAGE_SIZE",
+                          bDiscoverPaging ? CPLSPrintf("%llu", static_cast<unsigned long long>(nFileSpacePageSize)) : "UNKNOWN",
+                          "NISAR_IO");
+    poDS->SetMetadataItem("PAGE_BUFFER_SIZE", CPLSPrintf("%zu", nPageBufferSize), "NISAR_IO");
+    poDS->SetMetadataItem("CHUNK_CACHE_SIZE", CPLSPrintf("%zu", nCacheSizeBytes), "NISAR_IO");
+    poDS->SetMetadataItem("CHUNK_CACHE_SLOTS", CPLSPrintf("%zu", nCacheSlots), "NISAR_IO");
+    CPLDebug("NISAR_DRIVER", "I/O settings: page buffer %zu bytes, chunk cache %zu bytes / %zu slots",
+             nPageBufferSize, nCacheSizeBytes, nCacheSlots);
+
     H5E_auto2_t old_func_exists; void *old_client_data_exists;
     H5Eget_auto2(H5E_DEFAULT, &old_func_exists, &old_client_data_exists);
     H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
@@ -2639,6 +3075,22 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
     }
 
     poDS->hDataset = H5Dopen2(poDS->hHDF5, pathToOpen, dapl_id);
+
+    // Multi-polarization: the sibling terms of the same group, same access list
+    if (poDS->hDataset >= 0 && !poDS->m_aosPolTerms.empty()) {
+        const std::string sGroupPath = std::string(pathToOpen).substr(0, std::string(pathToOpen).find_last_of('/') + 1);
+        poDS->m_ahPolDatasets.push_back(poDS->hDataset);
+        for (size_t i = 1; i < poDS->m_aosPolTerms.size(); i++) {
+            const std::string sTermPath = sGroupPath + poDS->m_aosPolTerms[i];
+            const hid_t hTerm = H5Dopen2(poDS->hHDF5, sTermPath.c_str(), dapl_id);
+            if (hTerm < 0) {
+                CPLError(CE_Failure, CPLE_OpenFailed, "H5Dopen2 failed for dataset '%s'.", sTermPath.c_str());
+                if (bNeedToCloseDapl) H5Pclose(dapl_id);
+                delete poDS; return nullptr;
+            }
+            poDS->m_ahPolDatasets.push_back(hTerm);
+        }
+    }
     if (bNeedToCloseDapl) H5Pclose(dapl_id);
 
     if (poDS->hDataset < 0) {
@@ -2659,6 +3111,22 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
         delete poDS; return nullptr;
     }
 
+    // DERIVED: the bands decode straight to a Float32 quantity of the complex samples
+    if (const char* pszDerived = CSLFetchNameValue(poOpenInfo->papszOpenOptions, "DERIVED")) {
+        poDS->m_eDerived = NisarDerived::Parse(pszDerived);
+        if (poDS->m_eDerived == NisarDerived::Kind::None) {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "NISAR: Invalid DERIVED=%s; expected AMPLITUDE, PHASE, INTENSITY, DB, REAL or IMAG.", pszDerived);
+            delete poDS; return nullptr;
+        }
+        if (!GDALDataTypeIsComplex(poDS->eDataType)) {
+            CPLError(CE_Failure, CPLE_NotSupported, "NISAR: DERIVED=%s requires a complex layer; this one is %s.",
+                     pszDerived, GDALGetDataTypeName(poDS->eDataType));
+            delete poDS; return nullptr;
+        }
+        poDS->m_bDerivedFast = !EQUAL(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "DERIVED_ACCURACY", "FAST"), "EXACT");
+    }
+
     hid_t hDataspace = H5Dget_space(poDS->hDataset);
     if (hDataspace < 0) {
         delete poDS; return nullptr;
@@ -2691,22 +3159,69 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
         delete poDS; return nullptr;
     }
 
-    double dfNoData = 0.0;
-    bool bHasNoData = false;
-    H5E_auto2_t old_func_fill; void *old_client_data_fill;
-    H5Eget_auto2(H5E_DEFAULT, &old_func_fill, &old_client_data_fill);
-    H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
-    hid_t hFillAttr = H5Aopen(poDS->hDataset, "_FillValue", H5P_DEFAULT);
-    if (hFillAttr >= 0) {
-        if (H5Aread(hFillAttr, H5T_NATIVE_DOUBLE, &dfNoData) >= 0) bHasNoData = true;
-        H5Aclose(hFillAttr);
+    // Every term must match the first one in shape; types may differ (e.g. the
+    // complex HHVV next to real diagonal terms) unless DERIVED needs them complex
+    if (!poDS->m_ahPolDatasets.empty()) {
+        if (nDims != 2) {
+            CPLError(CE_Failure, CPLE_NotSupported, "NISAR: Multi-polarization open requires 2D layers.");
+            delete poDS; return nullptr;
+        }
+        for (size_t i = 1; i < poDS->m_ahPolDatasets.size(); i++) {
+            const hid_t hTermType = H5Dget_type(poDS->m_ahPolDatasets[i]);
+            const GDALDataType eTermType = (hTermType >= 0) ? NisarDataset::GetGDALDataType(hTermType) : GDT_Unknown;
+            if (hTermType >= 0) H5Tclose(hTermType);
+            hsize_t adimsTerm[H5S_MAX_RANK] = {0};
+            const hid_t hTermSpace = H5Dget_space(poDS->m_ahPolDatasets[i]);
+            const int nTermDims = (hTermSpace >= 0) ? H5Sget_simple_extent_ndims(hTermSpace) : -1;
+            if (nTermDims == 2) H5Sget_simple_extent_dims(hTermSpace, adimsTerm, nullptr);
+            if (hTermSpace >= 0) H5Sclose(hTermSpace);
+            const bool bTypeOK = eTermType != GDT_Unknown &&
+                (poDS->m_eDerived == NisarDerived::Kind::None || eTermType == poDS->eDataType);
+            if (!bTypeOK || nTermDims != 2 ||
+                static_cast<int>(adimsTerm[0]) != poDS->nRasterYSize || static_cast<int>(adimsTerm[1]) != poDS->nRasterXSize) {
+                CPLError(CE_Failure, CPLE_AppDefined, "NISAR: Term %s does not match %s in shape or data type.",
+                         poDS->m_aosPolTerms[i].c_str(), poDS->m_aosPolTerms[0].c_str());
+                delete poDS; return nullptr;
+            }
+        }
+        nBandsToCreate = static_cast<int>(poDS->m_ahPolDatasets.size());
     }
-    H5Eset_auto2(H5E_DEFAULT, old_func_fill, old_client_data_fill);
 
+    H5E_auto2_t old_func_fill; void *old_client_data_fill;
     for (int i = 0; i < nBandsToCreate; i++) {
+        double dfNoData = 0.0;
+        bool bHasNoData = false;
+        H5Eget_auto2(H5E_DEFAULT, &old_func_fill, &old_client_data_fill);
+        H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+        hid_t hFillAttr = H5Aopen(poDS->GetBandDatasetHandle(i + 1), "_FillValue", H5P_DEFAULT);
+        if (hFillAttr >= 0) {
+            if (H5Aread(hFillAttr, H5T_NATIVE_DOUBLE, &dfNoData) >= 0) bHasNoData = true;
+            H5Aclose(hFillAttr);
+        }
+        H5Eset_auto2(H5E_DEFAULT, old_func_fill, old_client_data_fill);
+
         NisarRasterBand* poBand = new NisarRasterBand(poDS, i + 1);
         poDS->SetBand(i + 1, poBand);
-        if (bHasNoData) poBand->SetNoDataValue(dfNoData);
+        // A derived quantity keeps a NaN fill; other fills do not map to one value
+        if (bHasNoData && (poDS->m_eDerived == NisarDerived::Kind::None || std::isnan(dfNoData)))
+            poBand->SetNoDataValue(dfNoData);
+        if (!poDS->m_aosPolTerms.empty()) {
+            poBand->SetDescription(poDS->m_aosPolTerms[i].c_str());
+            poBand->SetMetadataItem("POLARIZATION", poDS->m_aosPolTerms[i].c_str());
+        }
+    }
+
+    // APPLY_MASK: once every band exists, so that a 3D mask can match them slice by slice
+    if (poDS->m_bApplyMask) {
+        int nMasked = 0;
+        for (int i = 1; i <= poDS->GetRasterCount(); i++) {
+            if (static_cast<NisarRasterBand*>(poDS->GetRasterBand(i))->EnableApplyMask()) nMasked++;
+        }
+        if (nMasked == 0) {
+            CPLError(CE_Warning, CPLE_AppDefined, "NISAR: APPLY_MASK=YES but no usable mask was found next to %s.", pathToOpen);
+        } else {
+            poDS->SetMetadataItem("APPLY_MASK", "YES");
+        }
     }
 
     if (nDims == 3 && poDS->hDataset >= 0) {
@@ -2746,8 +3261,18 @@ GDALDataset *NisarDataset::Open(GDALOpenInfo *poOpenInfo)
 
     poDS->SetDescription(poOpenInfo->pszFilename);
     if (pathToOpen) poDS->SetMetadataItem("HDF5_PATH", pathToOpen);
+    if (!poDS->m_aosPolTerms.empty()) {
+        std::string sTerms;
+        for (const auto& sTerm : poDS->m_aosPolTerms) sTerms += (sTerms.empty() ? "" : ",") + sTerm;
+        poDS->SetMetadataItem("POLARIZATIONS", sTerms.c_str());
+    }
+    if (poDS->m_eDerived != NisarDerived::Kind::None) {
+        poDS->SetMetadataItem("DERIVED", NisarDerived::GetName(poDS->m_eDerived));
+        poDS->SetMetadataItem("DERIVED_ACCURACY", poDS->m_bDerivedFast ? "FAST" : "EXACT");
+    }
 
-    if (poDS->hDataset >= 0) {
+    // The generic derived datasets would re-derive an already derived band
+    if (poDS->hDataset >= 0 && poDS->m_eDerived == NisarDerived::Kind::None) {
         std::string sTargetString = std::string("NISAR:") + poDS->pszFilename + ":" + pathToOpen;
         bool bIsComplex = GDALDataTypeIsComplex(poDS->eDataType);
         bool bIsNumeric = (poDS->eDataType > GDT_Unknown && poDS->eDataType < GDT_CInt16);
@@ -3497,8 +4022,10 @@ static bool Read2DSliceAsVec(hid_t hLocation, const char *pszPath,
         goto cleanup;
     }
 
-    if (H5Dread(hDset, H5T_NATIVE_DOUBLE, hMemSpace, hFileSpace, H5P_DEFAULT,
-                vec.data()) < 0)
+    // Metadata cube slices span many chunks; use the vector DXPL so the
+    // VFL receives them as one coalesced multi-range request.
+    if (H5Dread(hDset, H5T_NATIVE_DOUBLE, hMemSpace, hFileSpace,
+                NisarVFL::HDF5VFLGetVectorDXPL(), vec.data()) < 0)
     {
         CPLError(CE_Warning, CPLE_FileIO, "Failed to read data slice from %s",
                  pszPath);
@@ -48,6 +48,8 @@
 #include "gdal.h"  // Include GDAL header for CPLErr and error codes
 #include "gdal_version.h"
 
+#include "nisarderived.h"
+
 class NisarRasterBand;
 
 // DEBUGGING: PRINT GDAL VERSION VALUES
@@ -129,7 +131,31 @@ class NisarDataset final : public GDALPamDataset
     std::string m_sInst; // LSAR or SSAR
     std::string m_sFreq; // A or B
     std::string m_sPol;  // HH, HV, etc.
+    // POL=ALL or a list: one band per term, all opened from this file.
+    // m_ahPolDatasets[0] is hDataset; the others are owned here.
+    std::vector<std::string> m_aosPolTerms;
+    std::vector<hid_t> m_ahPolDatasets;
     bool m_bMaskEnabled = false; //Default to NO
+    bool m_bApplyMask = false;   // APPLY_MASK: masked pixels read as nodata
+    // Layer mask bands by slice: one shared by every term of a 2D layer,
+    // one per band when a 3D mask has a slice per band. Owned here.
+    std::vector<NisarRasterBand*> m_apoLayerMasks;
+    std::string m_sScanOrder = "AUTO"; // SCAN_ORDER: AUTO, FILE_OFFSET or ROW_MAJOR
+    // Synthetic blocks: BLOCK_MULTIPLE=N[xM] or BLOCK_SIZE=WxH (0 = unset)
+    int m_nBlockMultipleX = 1;
+    int m_nBlockMultipleY = 1;
+    int m_nRequestedBlockXSize = 0;
+    int m_nRequestedBlockYSize = 0;
+    int m_nStripHeight = 0; // STRIP_HEIGHT rows for contiguous/compact layers (0 = auto)
+    // DERIVED=AMPLITUDE|PHASE|... on a complex layer; DERIVED_ACCURACY=FAST|EXACT
+    NisarDerived::Kind m_eDerived = NisarDerived::Kind::None;
+    bool m_bDerivedFast = true;
+
+    // Local-file memory mapping shared by all bands (POSIX only)
+    std::mutex m_oMapMutex;
+    bool m_bMapAttempted = false;
+    void *m_pMapBase = nullptr;
+    size_t m_nMapSize = 0;
 
   private:  // Keep static helpers private if only used internally
     struct MetadataCategory {
@@ -178,6 +204,30 @@ class NisarDataset final : public GDALPamDataset
         return hDataset;
     }
 
+    // The HDF5 dataset behind a band: its own term in multi-polarization mode
+    hid_t GetBandDatasetHandle(int nBand) const
+    {
+        if (nBand >= 1 && nBand <= static_cast<int>(m_ahPolDatasets.size())) return m_ahPolDatasets[nBand - 1];
+        return hDataset;
+    }
+
+    // Logical block size for a layer chunked nChunkX x nChunkY
+    void GetSyntheticBlockSize(int nChunkX, int nChunkY, int nXSize, int nYSize,
+                               int *pnBlockX, int *pnBlockY) const;
+
+    // Zero-copy access for local granules; nullptr for remote/unsupported
+    const GByte *GetMappedFile(const std::string &sRawPath, size_t *pnMapSize);
+    void AdviseMappedRange(vsi_l_offset nOffset, size_t nSize);
+
+#if GDAL_VERSION_MAJOR > 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR >= 7)
+    // Raw chunk passthrough for recompression-free copies (GDAL 3.7+)
+    CPLStringList GetCompressionFormats(int nXOff, int nYOff, int nXSize, int nYSize,
+                                        int nBandCount, const int *panBandList) override;
+    CPLErr ReadCompressedData(const char *pszFormat, int nXOff, int nYOff, int nXSize, int nYSize,
+                              int nBandCount, const int *panBandList, void **ppBuffer,
+                              size_t *pnBufferSize, char **ppszDetailedFormat) override;
+#endif
+
     //virtual CPLErr GetRasterBand( int nBand, GDALRasterBand ** ppBand );
     char **GetMetadataDomainList() override;
     char **GetMetadata(const char *pszDomain = "") override;
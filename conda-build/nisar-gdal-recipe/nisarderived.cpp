@@ -0,0 +1,380 @@
+// nisarderived.cpp
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#include "nisarderived.h"
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace NisarDerived
+{
+
+namespace
+{
+
+constexpr float kPi = 3.14159265358979f;
+constexpr float kPiOver2 = 1.57079632679490f;
+constexpr float kPiOver4 = 0.78539816339745f;
+constexpr float kTanPiOver8 = 0.41421356237310f;
+constexpr float kLn2 = 0.69314718055995f;
+constexpr float kSqrt2 = 1.41421356237310f;
+constexpr float kDBPerNeper = 4.34294481903252f;  // 10 / ln(10)
+
+// Cephes atanf polynomial, valid on [-tan(pi/8), tan(pi/8)]
+inline float AtanPoly(float a)
+{
+    const float z = a * a;
+    return ((((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z) * a + a;
+}
+
+inline float FastAtan2(float y, float x)
+{
+    if (std::isnan(x) || std::isnan(y)) return std::numeric_limits<float>::quiet_NaN();
+    const float ax = std::fabs(x), ay = std::fabs(y);
+    const float mx = std::max(ax, ay), mn = std::min(ax, ay);
+    float a = mx > 0 ? mn / mx : 0.0f;
+    float r = 0.0f;
+    if (a > kTanPiOver8) {
+        r = kPiOver4;
+        a = (a - 1.0f) / (a + 1.0f);
+    }
+    r += AtanPoly(a);
+    if (ay > ax) r = kPiOver2 - r;
+    if (x < 0) r = kPi - r;
+    return std::copysign(r, y);
+}
+
+// 10 * log10(x) for x >= 0: exponent plus ln(m) = 2 atanh((m - 1) / (m + 1))
+// with m in [sqrt(1/2), sqrt(2)), where the series is cut after t^9
+inline float FastDB(float x)
+{
+    if (!(x < std::numeric_limits<float>::infinity())) return x;  // +inf, NaN
+    if (x <= 0) return x == 0 ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+    int nExpBias = 127;
+    if (x < std::numeric_limits<float>::min()) {
+        x *= 8388608.0f;  // 2^23: denormals become normal
+        nExpBias += 23;
+    }
+    uint32_t nBits;
+    memcpy(&nBits, &x, sizeof(nBits));
+    float e = static_cast<float>(static_cast<int>(nBits >> 23) - nExpBias);
+    nBits = (nBits & 0x007fffffu) | 0x3f800000u;
+    float m;
+    memcpy(&m, &nBits, sizeof(m));
+    if (m > kSqrt2) {
+        m *= 0.5f;
+        e += 1.0f;
+    }
+    const float t = (m - 1.0f) / (m + 1.0f);
+    const float t2 = t * t;
+    const float fLnM = 2.0f * t * (1.0f + t2 * (1.0f / 3 + t2 * (1.0f / 5 + t2 * (1.0f / 7 + t2 * (1.0f / 9)))));
+    return (e * kLn2 + fLnM) * kDBPerNeper;
+}
+
+inline float ScalarDerived(Kind eKind, bool bFast, float re, float im)
+{
+    switch (eKind) {
+        case Kind::Real: return re;
+        case Kind::Imag: return im;
+        case Kind::Intensity: return re * re + im * im;
+        case Kind::Amplitude: return std::sqrt(re * re + im * im);
+        case Kind::Phase: return bFast ? FastAtan2(im, re) : std::atan2(im, re);
+        case Kind::DB: return bFast ? FastDB(re * re + im * im) : 10.0f * std::log10(re * re + im * im);
+        case Kind::None: break;
+    }
+    return re;
+}
+
+#ifdef __AVX2__
+inline __m256 AbsPs(__m256 v)
+{
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v);
+}
+
+inline __m256 FastAtan2Ps(__m256 y, __m256 x)
+{
+    const __m256 ax = AbsPs(x), ay = AbsPs(y);
+    const __m256 mx = _mm256_max_ps(ax, ay), mn = _mm256_min_ps(ax, ay);
+    const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+    __m256 a = _mm256_and_ps(_mm256_div_ps(mn, mx), _mm256_cmp_ps(mx, zero, _CMP_GT_OQ));
+    const __m256 big = _mm256_cmp_ps(a, _mm256_set1_ps(kTanPiOver8), _CMP_GT_OQ);
+    a = _mm256_blendv_ps(a, _mm256_div_ps(_mm256_sub_ps(a, one), _mm256_add_ps(a, one)), big);
+    __m256 r = _mm256_and_ps(_mm256_set1_ps(kPiOver4), big);
+
+    const __m256 z = _mm256_mul_ps(a, a);
+    __m256 p = _mm256_set1_ps(8.05374449538e-2f);
+    p = _mm256_sub_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(1.38776856032e-1f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(1.99777106478e-1f));
+    p = _mm256_sub_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(3.33329491539e-1f));
+    r = _mm256_add_ps(r, _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(p, z), a), a));
+
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(kPiOver2), r), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(kPi), r), _mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+    r = _mm256_or_ps(r, _mm256_and_ps(y, _mm256_set1_ps(-0.0f)));  // copysign (r >= 0 here)
+    return _mm256_blendv_ps(r, _mm256_set1_ps(std::numeric_limits<float>::quiet_NaN()),
+                            _mm256_cmp_ps(x, y, _CMP_UNORD_Q));
+}
+
+inline __m256 FastDBPs(__m256 x)
+{
+    const __m256 small = _mm256_cmp_ps(x, _mm256_set1_ps(std::numeric_limits<float>::min()), _CMP_LT_OQ);
+    const __m256 xs = _mm256_blendv_ps(x, _mm256_mul_ps(x, _mm256_set1_ps(8388608.0f)), small);
+    const __m256i bits = _mm256_castps_si256(xs);
+    __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+    e = _mm256_sub_ps(e, _mm256_and_ps(small, _mm256_set1_ps(23.0f)));
+    __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)),
+                                                   _mm256_set1_epi32(0x3f800000)));
+    const __m256 big = _mm256_cmp_ps(m, _mm256_set1_ps(kSqrt2), _CMP_GT_OQ);
+    m = _mm256_blendv_ps(m, _mm256_mul_ps(m, _mm256_set1_ps(0.5f)), big);
+    e = _mm256_add_ps(e, _mm256_and_ps(big, _mm256_set1_ps(1.0f)));
+
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 t = _mm256_div_ps(_mm256_sub_ps(m, one), _mm256_add_ps(m, one));
+    const __m256 t2 = _mm256_mul_ps(t, t);
+    __m256 p = _mm256_set1_ps(1.0f / 9);
+    p = _mm256_add_ps(_mm256_mul_ps(p, t2), _mm256_set1_ps(1.0f / 7));
+    p = _mm256_add_ps(_mm256_mul_ps(p, t2), _mm256_set1_ps(1.0f / 5));
+    p = _mm256_add_ps(_mm256_mul_ps(p, t2), _mm256_set1_ps(1.0f / 3));
+    p = _mm256_add_ps(_mm256_mul_ps(p, t2), one);
+    const __m256 lnm = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), t), p);
+    __m256 r = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(e, _mm256_set1_ps(kLn2)), lnm), _mm256_set1_ps(kDBPerNeper));
+
+    // 0 -> -inf; +inf and NaN pass through (intensities are never negative)
+    r = _mm256_blendv_ps(r, _mm256_set1_ps(-std::numeric_limits<float>::infinity()),
+                         _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_EQ_OQ));
+    return _mm256_blendv_ps(x, r, _mm256_cmp_ps(x, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_LT_OQ));
+}
+#elif defined(__aarch64__) || defined(_M_ARM64)
+inline float32x4_t FastAtan2Ps(float32x4_t y, float32x4_t x)
+{
+    const float32x4_t ax = vabsq_f32(x), ay = vabsq_f32(y);
+    const float32x4_t mx = vmaxq_f32(ax, ay), mn = vminq_f32(ax, ay);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t a = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(vdivq_f32(mn, mx)),
+                                                    vcgtq_f32(mx, vdupq_n_f32(0.0f))));
+    const uint32x4_t big = vcgtq_f32(a, vdupq_n_f32(kTanPiOver8));
+    a = vbslq_f32(big, vdivq_f32(vsubq_f32(a, one), vaddq_f32(a, one)), a);
+    float32x4_t r = vbslq_f32(big, vdupq_n_f32(kPiOver4), vdupq_n_f32(0.0f));
+
+    const float32x4_t z = vmulq_f32(a, a);
+    float32x4_t p = vdupq_n_f32(8.05374449538e-2f);
+    p = vsubq_f32(vmulq_f32(p, z), vdupq_n_f32(1.38776856032e-1f));
+    p = vaddq_f32(vmulq_f32(p, z), vdupq_n_f32(1.99777106478e-1f));
+    p = vsubq_f32(vmulq_f32(p, z), vdupq_n_f32(3.33329491539e-1f));
+    r = vaddq_f32(r, vaddq_f32(vmulq_f32(vmulq_f32(p, z), a), a));
+
+    r = vbslq_f32(vcgtq_f32(ay, ax), vsubq_f32(vdupq_n_f32(kPiOver2), r), r);
+    r = vbslq_f32(vcltq_f32(x, vdupq_n_f32(0.0f)), vsubq_f32(vdupq_n_f32(kPi), r), r);
+    r = vbslq_f32(vdupq_n_u32(0x80000000u), y, r);  // copysign
+    const uint32x4_t ordered = vandq_u32(vceqq_f32(x, x), vceqq_f32(y, y));
+    return vbslq_f32(ordered, r, vdupq_n_f32(std::numeric_limits<float>::quiet_NaN()));
+}
+
+inline float32x4_t FastDBPs(float32x4_t x)
+{
+    const uint32x4_t small = vcltq_f32(x, vdupq_n_f32(std::numeric_limits<float>::min()));
+    const float32x4_t xs = vbslq_f32(small, vmulq_f32(x, vdupq_n_f32(8388608.0f)), x);
+    const uint32x4_t bits = vreinterpretq_u32_f32(xs);
+    float32x4_t e = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+    e = vbslq_f32(small, vsubq_f32(e, vdupq_n_f32(23.0f)), e);
+    float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007fffffu)), vdupq_n_u32(0x3f800000u)));
+    const uint32x4_t big = vcgtq_f32(m, vdupq_n_f32(kSqrt2));
+    m = vbslq_f32(big, vmulq_f32(m, vdupq_n_f32(0.5f)), m);
+    e = vbslq_f32(big, vaddq_f32(e, vdupq_n_f32(1.0f)), e);
+
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t t = vdivq_f32(vsubq_f32(m, one), vaddq_f32(m, one));
+    const float32x4_t t2 = vmulq_f32(t, t);
+    float32x4_t p = vdupq_n_f32(1.0f / 9);
+    p = vaddq_f32(vmulq_f32(p, t2), vdupq_n_f32(1.0f / 7));
+    p = vaddq_f32(vmulq_f32(p, t2), vdupq_n_f32(1.0f / 5));
+    p = vaddq_f32(vmulq_f32(p, t2), vdupq_n_f32(1.0f / 3));
+    p = vaddq_f32(vmulq_f32(p, t2), one);
+    const float32x4_t lnm = vmulq_f32(vmulq_f32(vdupq_n_f32(2.0f), t), p);
+    float32x4_t r = vmulq_f32(vaddq_f32(vmulq_f32(e, vdupq_n_f32(kLn2)), lnm), vdupq_n_f32(kDBPerNeper));
+
+    r = vbslq_f32(vceqq_f32(x, vdupq_n_f32(0.0f)), vdupq_n_f32(-std::numeric_limits<float>::infinity()), r);
+    return vbslq_f32(vcltq_f32(x, vdupq_n_f32(std::numeric_limits<float>::infinity())), r, x);
+}
+#endif
+
+void ApplyCFloat32(Kind eKind, bool bFast, const float *pafSrc, size_t nPixels, float *pafDst)
+{
+    size_t i = 0;
+    // EXACT phase / dB go through libm, one sample at a time
+    const bool bVector = bFast || (eKind != Kind::Phase && eKind != Kind::DB);
+#ifdef __AVX2__
+    if (bVector) {
+        for (; i + 8 <= nPixels; i += 8) {
+            const __m256 v0 = _mm256_loadu_ps(pafSrc + 2 * i);
+            const __m256 v1 = _mm256_loadu_ps(pafSrc + 2 * i + 8);
+            // Deinterleave: shuffle within lanes, then restore the lane order
+            const __m256 re = _mm256_castpd_ps(_mm256_permute4x64_pd(
+                _mm256_castps_pd(_mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0))), 0xD8));
+            const __m256 im = _mm256_castpd_ps(_mm256_permute4x64_pd(
+                _mm256_castps_pd(_mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1))), 0xD8));
+            const __m256 pow = _mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im));
+            __m256 out;
+            switch (eKind) {
+                case Kind::Real: out = re; break;
+                case Kind::Imag: out = im; break;
+                case Kind::Intensity: out = pow; break;
+                case Kind::Amplitude: out = _mm256_sqrt_ps(pow); break;
+                case Kind::Phase: out = FastAtan2Ps(im, re); break;
+                case Kind::DB: out = FastDBPs(pow); break;
+                default: out = re; break;
+            }
+            _mm256_storeu_ps(pafDst + i, out);
+        }
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (bVector) {
+        for (; i + 4 <= nPixels; i += 4) {
+            const float32x4x2_t v = vld2q_f32(pafSrc + 2 * i);
+            const float32x4_t re = v.val[0], im = v.val[1];
+            const float32x4_t pow = vaddq_f32(vmulq_f32(re, re), vmulq_f32(im, im));
+            float32x4_t out;
+            switch (eKind) {
+                case Kind::Real: out = re; break;
+                case Kind::Imag: out = im; break;
+                case Kind::Intensity: out = pow; break;
+                case Kind::Amplitude: out = vsqrtq_f32(pow); break;
+                case Kind::Phase: out = FastAtan2Ps(im, re); break;
+                case Kind::DB: out = FastDBPs(pow); break;
+                default: out = re; break;
+            }
+            vst1q_f32(pafDst + i, out);
+        }
+    }
+#endif
+    (void)bVector;
+    for (; i < nPixels; i++) pafDst[i] = ScalarDerived(eKind, bFast, pafSrc[2 * i], pafSrc[2 * i + 1]);
+}
+
+}  // namespace
+
+Kind Parse(const char *pszName)
+{
+    if (!pszName) return Kind::None;
+    if (EQUAL(pszName, "AMPLITUDE")) return Kind::Amplitude;
+    if (EQUAL(pszName, "PHASE")) return Kind::Phase;
+    if (EQUAL(pszName, "INTENSITY")) return Kind::Intensity;
+    if (EQUAL(pszName, "DB")) return Kind::DB;
+    if (EQUAL(pszName, "REAL")) return Kind::Real;
+    if (EQUAL(pszName, "IMAG")) return Kind::Imag;
+    return Kind::None;
+}
+
+const char *GetName(Kind eKind)
+{
+    switch (eKind) {
+        case Kind::Amplitude: return "AMPLITUDE";
+        case Kind::Phase: return "PHASE";
+        case Kind::Intensity: return "INTENSITY";
+        case Kind::DB: return "DB";
+        case Kind::Real: return "REAL";
+        case Kind::Imag: return "IMAG";
+        case Kind::None: break;
+    }
+    return "NONE";
+}
+
+void Apply(Kind eKind, bool bFast, const void *pSrc, GDALDataType eSrcType, size_t nPixels, float *pafDst)
+{
+    if (eSrcType == GDT_CFloat32) {
+        ApplyCFloat32(eKind, bFast, static_cast<const float *>(pSrc), nPixels, pafDst);
+        return;
+    }
+    // Other complex types: widen a strip at a time to CFloat32 on the stack
+    constexpr size_t nStrip = 1024;
+    float afStrip[2 * nStrip];
+    const int nSrcSize = GDALGetDataTypeSizeBytes(eSrcType);
+    for (size_t i = 0; i < nPixels; i += nStrip) {
+        const size_t n = std::min(nStrip, nPixels - i);
+        GDALCopyWords64(static_cast<const GByte *>(pSrc) + i * nSrcSize, eSrcType, nSrcSize, afStrip, GDT_CFloat32,
+                        2 * sizeof(float), static_cast<GPtrDiff_t>(n));
+        ApplyCFloat32(eKind, bFast, afStrip, n, pafDst + i);
+    }
+}
+
+void Combine(const float *const *papafTerms, int nTerms, const float *pafNumWeights, const float *pafDenWeights,
+             size_t nPixels, float *pafDst)
+{
+    // Zero weights drop out, so a ratio of two terms touches only those two planes
+    int anNum[8], anDen[8];
+    int nNum = 0, nDen = 0;
+    for (int k = 0; k < nTerms && k < 8; k++) {
+        if (pafNumWeights[k] != 0) anNum[nNum++] = k;
+        if (pafDenWeights && pafDenWeights[k] != 0) anDen[nDen++] = k;
+    }
+
+    size_t i = 0;
+#ifdef __AVX2__
+    for (; i + 8 <= nPixels; i += 8) {
+        __m256 num = _mm256_setzero_ps();
+        for (int j = 0; j < nNum; j++) {
+            num = _mm256_add_ps(num, _mm256_mul_ps(_mm256_set1_ps(pafNumWeights[anNum[j]]),
+                                                   _mm256_loadu_ps(papafTerms[anNum[j]] + i)));
+        }
+        if (pafDenWeights) {
+            __m256 den = _mm256_setzero_ps();
+            for (int j = 0; j < nDen; j++) {
+                den = _mm256_add_ps(den, _mm256_mul_ps(_mm256_set1_ps(pafDenWeights[anDen[j]]),
+                                                       _mm256_loadu_ps(papafTerms[anDen[j]] + i)));
+            }
+            num = _mm256_div_ps(num, den);
+        }
+        _mm256_storeu_ps(pafDst + i, num);
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    for (; i + 4 <= nPixels; i += 4) {
+        float32x4_t num = vdupq_n_f32(0.0f);
+        for (int j = 0; j < nNum; j++) {
+            num = vmlaq_n_f32(num, vld1q_f32(papafTerms[anNum[j]] + i), pafNumWeights[anNum[j]]);
+        }
+        if (pafDenWeights) {
+            float32x4_t den = vdupq_n_f32(0.0f);
+            for (int j = 0; j < nDen; j++) {
+                den = vmlaq_n_f32(den, vld1q_f32(papafTerms[anDen[j]] + i), pafDenWeights[anDen[j]]);
+            }
+            num = vdivq_f32(num, den);
+        }
+        vst1q_f32(pafDst + i, num);
+    }
+#endif
+    for (; i < nPixels; i++) {
+        float fNum = 0.0f;
+        for (int j = 0; j < nNum; j++) fNum += pafNumWeights[anNum[j]] * papafTerms[anNum[j]][i];
+        if (pafDenWeights) {
+            float fDen = 0.0f;
+            for (int j = 0; j < nDen; j++) fDen += pafDenWeights[anDen[j]] * papafTerms[anDen[j]][i];
+            fNum /= fDen;
+        }
+        pafDst[i] = fNum;
+    }
+}
+
+}  // namespace NisarDerived
@@ -0,0 +1,58 @@
+// nisarderived.h
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#ifndef NISAR_DERIVED_H
+#define NISAR_DERIVED_H
+
+#include <cstddef>
+
+#include "gdal.h"
+
+/***************************************************************************/
+/* Native derived bands (DERIVED open option).                             */
+/* A complex layer is served as Float32 AMPLITUDE, PHASE, INTENSITY, DB    */
+/* (10*log10 of the intensity), REAL or IMAG. The transform runs on each   */
+/* decoded chunk, so only the Float32 result reaches the block cache.      */
+/* FAST accuracy uses vectorized atan2/log10 approximations (PHASE within  */
+/* 3e-7 rad, DB within 4e-5 dB up to 200 dB); EXACT uses libm for both.   */
+/***************************************************************************/
+namespace NisarDerived
+{
+
+enum class Kind
+{
+    None,
+    Amplitude,
+    Phase,
+    Intensity,
+    DB,
+    Real,
+    Imag
+};
+
+// Case-insensitive; None for an unknown name
+Kind Parse(const char *pszName);
+const char *GetName(Kind eKind);
+
+// nPixels interleaved complex samples of eSrcType to Float32
+void Apply(Kind eKind, bool bFast, const void *pSrc, GDALDataType eSrcType, size_t nPixels, float *pafDst);
+
+// Polarimetric composites (COMPOSITE open option): per pixel
+// sum(num[k] * term[k]) / sum(den[k] * term[k]) over nTerms Float32 planes,
+// or the numerator alone when pafDenWeights is null. NaN in any term with a
+// non-zero weight propagates to the result.
+void Combine(const float *const *papafTerms, int nTerms, const float *pafNumWeights, const float *pafDenWeights,
+             size_t nPixels, float *pafDst);
+
+}  // namespace NisarDerived
+
+#endif  // NISAR_DERIVED_H
@@ -0,0 +1,195 @@
+// nisarfilters.cpp
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#include "nisarfilters.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+
+#include <algorithm>
+
+#ifdef USE_ZLIB_NG
+#include <zlib-ng.h>
+#else
+#include <zlib.h>
+#endif
+
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace NisarFilters
+{
+
+uint32_t Fletcher32(const GByte *pabyData, size_t nLength)
+{
+    size_t nWords = nLength / 2;
+    uint32_t nSum1 = 0, nSum2 = 0;
+    while (nWords) {
+        // 360 words keep both sums from overflowing before the fold
+        size_t nBatch = std::min<size_t>(nWords, 360);
+        nWords -= nBatch;
+        do {
+            nSum1 += static_cast<uint32_t>((pabyData[0] << 8) | pabyData[1]);
+            nSum2 += nSum1;
+            pabyData += 2;
+        } while (--nBatch);
+        nSum1 = (nSum1 & 0xffff) + (nSum1 >> 16);
+        nSum2 = (nSum2 & 0xffff) + (nSum2 >> 16);
+    }
+    if (nLength % 2) {
+        nSum1 += static_cast<uint32_t>(pabyData[0] << 8);
+        nSum2 += nSum1;
+        nSum1 = (nSum1 & 0xffff) + (nSum1 >> 16);
+        nSum2 = (nSum2 & 0xffff) + (nSum2 >> 16);
+    }
+    nSum1 = (nSum1 & 0xffff) + (nSum1 >> 16);
+    nSum2 = (nSum2 & 0xffff) + (nSum2 >> 16);
+    return (nSum2 << 16) | nSum1;
+}
+
+void FilterPipeline::Build(hid_t hDCPL)
+{
+    m_aoSteps.clear();
+    m_bNative = true;
+    m_iShuffle = m_iCodec = m_iFletcher = -1;
+    m_bVerifyChecksums = CPLTestBool(CPLGetConfigOption("NISAR_VERIFY_CHECKSUMS", "NO"));
+
+    const int nFilters = H5Pget_nfilters(hDCPL);
+    for (int i = 0; i < nFilters; i++) {
+        FilterStep oStep;
+        size_t nParams = 16;
+        oStep.anParams.resize(nParams);
+        char szName[128] = {0};
+        oStep.nId = H5Pget_filter2(hDCPL, static_cast<unsigned>(i), &oStep.nFlags, &nParams,
+                                   oStep.anParams.data(), sizeof(szName), szName, nullptr);
+        oStep.anParams.resize(std::min<size_t>(nParams, 16));
+        oStep.osName = szName;
+
+        const bool bFirst = (i == 0);
+        const bool bLast = (i == nFilters - 1);
+        if (oStep.nId == H5Z_FILTER_SHUFFLE && bFirst) {
+            m_iShuffle = i;
+        } else if ((oStep.nId == H5Z_FILTER_DEFLATE
+#ifdef USE_ZSTD
+                    || oStep.nId == NISAR_H5Z_FILTER_ZSTD
+#endif
+                   ) && m_iCodec < 0 && (bLast || i + 1 == nFilters - 1)) {
+            m_iCodec = i;
+        } else if (oStep.nId == H5Z_FILTER_FLETCHER32 && bLast) {
+            m_iFletcher = i;
+        } else {
+            m_bNative = false;
+        }
+        m_aoSteps.push_back(std::move(oStep));
+    }
+    // A codec, if any, must sit right before the checksum (or be last)
+    if (m_bNative && m_iCodec >= 0 && m_iFletcher >= 0 && m_iCodec != m_iFletcher - 1) m_bNative = false;
+
+    if (!m_bNative) {
+        CPLDebug("NISAR_DRIVER", "Filter pipeline '%s' has no native decoder; chunks are read through HDF5.",
+                 Describe().c_str());
+    }
+}
+
+int FilterPipeline::GetDeflateLevel() const
+{
+    if (!HasDeflate() || m_aoSteps[m_iCodec].anParams.empty()) return 1;
+    return static_cast<int>(m_aoSteps[m_iCodec].anParams[0]);
+}
+
+std::string FilterPipeline::Describe() const
+{
+    std::string osDesc;
+    for (const auto &oStep : m_aoSteps) {
+        if (!osDesc.empty()) osDesc += "+";
+        switch (oStep.nId) {
+            case H5Z_FILTER_SHUFFLE: osDesc += "shuffle"; break;
+            case H5Z_FILTER_DEFLATE: osDesc += "deflate"; break;
+            case H5Z_FILTER_FLETCHER32: osDesc += "fletcher32"; break;
+            case H5Z_FILTER_NBIT: osDesc += "nbit"; break;
+            case H5Z_FILTER_SCALEOFFSET: osDesc += "scaleoffset"; break;
+            case NISAR_H5Z_FILTER_ZSTD: osDesc += "zstd"; break;
+            default:
+                osDesc += oStep.osName.empty() ? CPLSPrintf("filter%d", static_cast<int>(oStep.nId)) : oStep.osName;
+                break;
+        }
+    }
+    return osDesc.empty() ? std::string("none") : osDesc;
+}
+
+bool FilterPipeline::Decode(const GByte *pSrc, size_t nSrcSize, unsigned int nFilterMask,
+                            size_t nExpectedSize, std::vector<GByte> &abyScratch,
+                            const GByte **ppOut, size_t *pnOutSize, bool *pbUnshuffle) const
+{
+    const GByte *pCur = pSrc;
+    size_t nCur = nSrcSize;
+    *pbUnshuffle = false;
+
+    // Undo the filters in reverse application order
+    for (int i = static_cast<int>(m_aoSteps.size()) - 1; i >= 0; i--) {
+        if (i < 32 && (nFilterMask & (1u << i))) continue; // Optional filter skipped for this chunk
+
+        const H5Z_filter_t nId = m_aoSteps[i].nId;
+        if (nId == H5Z_FILTER_FLETCHER32) {
+            if (nCur < 4) return false;
+            nCur -= 4;
+            if (m_bVerifyChecksums) {
+                const GByte *pabyStored = pCur + nCur;
+                const uint32_t nStored = static_cast<uint32_t>(pabyStored[0]) | (static_cast<uint32_t>(pabyStored[1]) << 8) |
+                                         (static_cast<uint32_t>(pabyStored[2]) << 16) | (static_cast<uint32_t>(pabyStored[3]) << 24);
+                // Files written before HDF5 1.6.3 swap the bytes within each 16-bit half
+                const uint32_t nReversed = static_cast<uint32_t>(pabyStored[1]) | (static_cast<uint32_t>(pabyStored[0]) << 8) |
+                                           (static_cast<uint32_t>(pabyStored[3]) << 16) | (static_cast<uint32_t>(pabyStored[2]) << 24);
+                const uint32_t nComputed = Fletcher32(pCur, nCur);
+                if (nComputed != nStored && nComputed != nReversed) {
+                    CPLError(CE_Failure, CPLE_AppDefined, "NISAR: Fletcher32 checksum mismatch in chunk.");
+                    return false;
+                }
+            }
+        } else if (nId == H5Z_FILTER_DEFLATE) {
+            // resize() will not zero-initialize bytes if the capacity is already large enough
+            if (abyScratch.size() < nExpectedSize) abyScratch.resize(nExpectedSize);
+#ifdef USE_ZLIB_NG
+            // The hardware-accelerated SIMD path
+            z_size_t destLen = static_cast<z_size_t>(nExpectedSize);
+            if (zng_uncompress(abyScratch.data(), &destLen, pCur, static_cast<z_size_t>(nCur)) != Z_OK) return false;
+#else
+            // The standard legacy zlib fallback path
+            uLongf destLen = static_cast<uLongf>(nExpectedSize);
+            if (uncompress(abyScratch.data(), &destLen, pCur, static_cast<uLong>(nCur)) != Z_OK) return false;
+#endif
+            pCur = abyScratch.data();
+            nCur = static_cast<size_t>(destLen);
+        }
+#ifdef USE_ZSTD
+        else if (nId == NISAR_H5Z_FILTER_ZSTD) {
+            if (abyScratch.size() < nExpectedSize) abyScratch.resize(nExpectedSize);
+            const size_t nOut = ZSTD_decompress(abyScratch.data(), nExpectedSize, pCur, nCur);
+            if (ZSTD_isError(nOut)) return false;
+            pCur = abyScratch.data();
+            nCur = nOut;
+        }
+#endif
+        else if (nId == H5Z_FILTER_SHUFFLE) {
+            *pbUnshuffle = true;
+        } else {
+            return false;
+        }
+    }
+
+    *ppOut = pCur;
+    *pnOutSize = nCur;
+    return true;
+}
+
+}  // namespace NisarFilters
@@ -0,0 +1,78 @@
+// nisarfilters.h
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#ifndef NISAR_FILTERS_H
+#define NISAR_FILTERS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cpl_port.h"
+#include "hdf5.h"
+
+namespace NisarFilters
+{
+
+// Registered HDF5 filter id of the Zstandard plugin (not in hdf5.h)
+constexpr H5Z_filter_t NISAR_H5Z_FILTER_ZSTD = 32015;
+
+struct FilterStep
+{
+    H5Z_filter_t nId = 0;
+    unsigned int nFlags = 0;
+    std::vector<unsigned int> anParams;
+    std::string osName;
+};
+
+/***************************************************************************/
+/* The dataset's filter pipeline, in application (write) order.           */
+/* Native decoding covers [SHUFFLE] -> [DEFLATE | ZSTD] -> [FLETCHER32];   */
+/* anything else is reported as non-native so chunks go through HDF5.     */
+/***************************************************************************/
+class FilterPipeline
+{
+  public:
+    // Reads every filter of a chunked dataset creation property list
+    void Build(hid_t hDCPL);
+
+    bool IsNative() const { return m_bNative; }
+    bool HasShuffle() const { return m_iShuffle >= 0; }
+    bool HasDeflate() const { return m_iCodec >= 0 && m_aoSteps[m_iCodec].nId == H5Z_FILTER_DEFLATE; }
+    int GetDeflateLevel() const;
+    const std::vector<FilterStep> &GetSteps() const { return m_aoSteps; }
+    // Short description of the pipeline, e.g. "shuffle+deflate+fletcher32"
+    std::string Describe() const;
+
+    // Reverses every active filter except SHUFFLE, which callers fuse with
+    // their unshuffle/endian kernel (*pbUnshuffle). nFilterMask is the
+    // per-chunk mask from H5Dchunk_iter: bit i set = filter i skipped.
+    // *ppOut points either into pSrc or into abyScratch.
+    bool Decode(const GByte *pSrc, size_t nSrcSize, unsigned int nFilterMask,
+                size_t nExpectedSize, std::vector<GByte> &abyScratch,
+                const GByte **ppOut, size_t *pnOutSize, bool *pbUnshuffle) const;
+
+  private:
+    std::vector<FilterStep> m_aoSteps;
+    bool m_bNative = true;
+    bool m_bVerifyChecksums = false;  // NISAR_VERIFY_CHECKSUMS
+    int m_iShuffle = -1;
+    int m_iCodec = -1;
+    int m_iFletcher = -1;
+};
+
+// HDF5's Fletcher-32 over 16-bit big-endian words
+uint32_t Fletcher32(const GByte *pabyData, size_t nLength);
+
+}  // namespace NisarFilters
+
+#endif  // NISAR_FILTERS_H
@@ -0,0 +1,56 @@
+// nisarlocalio.h
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#ifndef NISAR_LOCAL_IO_H
+#define NISAR_LOCAL_IO_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+namespace NisarLocalIO
+{
+
+/***************************************************************************/
+/* One byte range of a batched local read. pabyData points into an        */
+/* aligned allocation owned by the request (see FreeRequests()).           */
+/***************************************************************************/
+struct LocalReadRequest
+{
+    vsi_l_offset nOffset = 0;
+    size_t nSize = 0;
+    GByte *pabyData = nullptr;  // Out: first requested byte
+    void *pAlloc = nullptr;     // Out: aligned buffer backing pabyData
+    bool bOK = false;
+};
+
+// True when the plugin was built with liburing (USE_LIBURING) and the
+// running kernel accepts io_uring_setup(). Probed once per process.
+bool IsIOUringAvailable();
+
+// Submits every request of the batch at once, keeping up to nQueueDepth
+// reads in flight, and calls oOnComplete(i, bOK) as each one finishes.
+// bDirect opens the file with O_DIRECT (page-aligned buffers and offsets).
+// Returns false if the batch could not be started or any read failed.
+bool ReadBatchIOUring(const std::string &osPath,
+                      std::vector<LocalReadRequest> &aoRequests,
+                      int nQueueDepth, bool bDirect,
+                      const std::function<void(size_t, bool)> &oOnComplete);
+
+void FreeRequests(std::vector<LocalReadRequest> &aoRequests);
+
+}  // namespace NisarLocalIO
+
+#endif  // NISAR_LOCAL_IO_H
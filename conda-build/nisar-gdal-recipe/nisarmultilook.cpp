@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <cstring>
+
+#include "nisarmultilook.h"
+#include "nisarmultilookrasterband.h"
+#include "cpl_string.h"
+
+// ====================================================================
+// NisarMultilookDataset Implementation
+// ====================================================================
+
+NisarMultilookDataset::~NisarMultilookDataset()
+{
+    if (m_pasGCPs) {
+        GDALDeinitGCPs(m_nGCPCount, m_pasGCPs);
+        CPLFree(m_pasGCPs);
+    }
+    // Bands hold pointers into the source; it goes after them
+    FlushCache(true);
+    if (m_poSrcDS) GDALClose(m_poSrcDS);
+}
+
+#if GDAL_VERSION_MAJOR < 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR < 12)
+CPLErr NisarMultilookDataset::GetGeoTransform(double* padfTransform)
+{
+    memcpy(padfTransform, m_adfGeoTransform, 6 * sizeof(double));
+    return m_bHasGeoTransform ? CE_None : CE_Failure;
+}
+#else
+CPLErr NisarMultilookDataset::GetGeoTransform(GDALGeoTransform& gt) const
+{
+    for (int i = 0; i < 6; ++i) {
+        gt[i] = m_adfGeoTransform[i];
+    }
+    return m_bHasGeoTransform ? CE_None : CE_Failure;
+}
+#endif
+
+const OGRSpatialReference* NisarMultilookDataset::GetSpatialRef() const
+{
+    return m_poSrcDS ? m_poSrcDS->GetSpatialRef() : nullptr;
+}
+
+int NisarMultilookDataset::GetGCPCount()
+{
+    return m_nGCPCount;
+}
+
+const GDAL_GCP* NisarMultilookDataset::GetGCPs()
+{
+    return m_pasGCPs;
+}
+
+const OGRSpatialReference* NisarMultilookDataset::GetGCPSpatialRef() const
+{
+    return m_poSrcDS ? m_poSrcDS->GetGCPSpatialRef() : nullptr;
+}
+
+GDALDataset* NisarMultilookDataset::Open(GDALOpenInfo* poOpenInfo)
+{
+    // "AZxRG", or a single N for N x N looks
+    const char* pszLooks = CSLFetchNameValue(poOpenInfo->papszOpenOptions, "MULTILOOK");
+    int nLooksAz = 0, nLooksRg = 0;
+    const CPLStringList aosLooks(CSLTokenizeString2(pszLooks, "xX", 0));
+    if (aosLooks.size() == 1) {
+        nLooksAz = nLooksRg = atoi(aosLooks[0]);
+    } else if (aosLooks.size() == 2) {
+        nLooksAz = atoi(aosLooks[0]);
+        nLooksRg = atoi(aosLooks[1]);
+    }
+    if (nLooksAz < 1 || nLooksRg < 1) {
+        CPLError(CE_Failure, CPLE_IllegalArg, "NISAR: Invalid MULTILOOK=%s; expected AZxRG, e.g. 4x2.", pszLooks);
+        return nullptr;
+    }
+
+    // Open the full-resolution layer with the remaining options
+    CPLStringList aosSrcOptions;
+    for (char** papszIter = poOpenInfo->papszOpenOptions; papszIter && *papszIter; ++papszIter) {
+        if (!STARTS_WITH_CI(*papszIter, "MULTILOOK")) aosSrcOptions.AddString(*papszIter);
+    }
+    const char* const apszAllowedDrivers[] = { "NISAR", nullptr };
+    GDALDataset* poSrcDS = static_cast<GDALDataset*>(
+        GDALOpenEx(poOpenInfo->pszFilename, GDAL_OF_RASTER | GDAL_OF_INTERNAL, apszAllowedDrivers, aosSrcOptions.List(), nullptr));
+    if (poSrcDS == nullptr) return nullptr;
+
+    if (poSrcDS->GetRasterXSize() / nLooksRg < 1 || poSrcDS->GetRasterYSize() / nLooksAz < 1) {
+        CPLError(CE_Failure, CPLE_IllegalArg, "NISAR: MULTILOOK=%dx%d exceeds the %dx%d layer.",
+                 nLooksAz, nLooksRg, poSrcDS->GetRasterXSize(), poSrcDS->GetRasterYSize());
+        GDALClose(poSrcDS);
+        return nullptr;
+    }
+
+    NisarMultilookDataset* poDS = new NisarMultilookDataset();
+    poDS->m_poSrcDS = poSrcDS;
+    poDS->m_nLooksAz = nLooksAz;
+    poDS->m_nLooksRg = nLooksRg;
+    poDS->m_eMode = NisarGetComplexLookMode(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "MULTILOOK_MODE", "INTENSITY"));
+    if (poDS->m_eMode == NisarLookMode::Average) poDS->m_eMode = NisarLookMode::Intensity;
+    poDS->nRasterXSize = poSrcDS->GetRasterXSize() / nLooksRg;
+    poDS->nRasterYSize = poSrcDS->GetRasterYSize() / nLooksAz;
+
+    // Geocoded layers: coarser pixels; radar layers: GCPs in multilooked pixels
+    double adfSrcGT[6];
+    if (GDALGetGeoTransform(poSrcDS, adfSrcGT) == CE_None) {
+        poDS->m_adfGeoTransform[0] = adfSrcGT[0];
+        poDS->m_adfGeoTransform[1] = adfSrcGT[1] * nLooksRg;
+        poDS->m_adfGeoTransform[2] = adfSrcGT[2] * nLooksAz;
+        poDS->m_adfGeoTransform[3] = adfSrcGT[3];
+        poDS->m_adfGeoTransform[4] = adfSrcGT[4] * nLooksRg;
+        poDS->m_adfGeoTransform[5] = adfSrcGT[5] * nLooksAz;
+        poDS->m_bHasGeoTransform = true;
+    }
+    if (poSrcDS->GetGCPCount() > 0) {
+        poDS->m_nGCPCount = poSrcDS->GetGCPCount();
+        poDS->m_pasGCPs = GDALDuplicateGCPs(poDS->m_nGCPCount, poSrcDS->GetGCPs());
+        for (int i = 0; i < poDS->m_nGCPCount; i++) {
+            poDS->m_pasGCPs[i].dfGCPPixel /= nLooksRg;
+            poDS->m_pasGCPs[i].dfGCPLine /= nLooksAz;
+        }
+    }
+
+    poDS->SetMetadata(poSrcDS->GetMetadata());
+    poDS->SetMetadataItem("MULTILOOK_AZIMUTH_LOOKS", CPLSPrintf("%d", nLooksAz));
+    poDS->SetMetadataItem("MULTILOOK_RANGE_LOOKS", CPLSPrintf("%d", nLooksRg));
+    poDS->SetMetadataItem("MULTILOOK_MODE", poDS->m_eMode == NisarLookMode::Amplitude ? "AMPLITUDE" : "INTENSITY");
+
+    for (int i = 1; i <= poSrcDS->GetRasterCount(); i++) {
+        poDS->SetBand(i, new NisarMultilookRasterBand(poDS, i, poSrcDS->GetRasterBand(i)));
+    }
+
+    CPLDebug("NISAR_DRIVER", "Multilook: %dx%d looks | %dx%d -> %dx%d", nLooksAz, nLooksRg,
+             poSrcDS->GetRasterXSize(), poSrcDS->GetRasterYSize(), poDS->nRasterXSize, poDS->nRasterYSize);
+    return poDS;
+}
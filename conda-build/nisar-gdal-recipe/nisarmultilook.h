@@ -0,0 +1,60 @@
+#ifndef NISAR_MULTILOOK_H
+#define NISAR_MULTILOOK_H
+
+#include <string>
+
+#include "gdal_priv.h"
+#include "ogr_spatialref.h"
+#include "gdal_version.h"
+
+#include "nisarrasterband.h"
+#include "nisaroverviewband.h"  // NisarLookMode, NisarComplexMultilook
+
+// Compatibility shim for GDAL < 3.12 GeoTransform signature
+#if GDAL_VERSION_MAJOR < 3 || (GDAL_VERSION_MAJOR == 3 && GDAL_VERSION_MINOR < 12)
+    #ifndef USE_LEGACY_GEOTRANSFORM
+    #define USE_LEGACY_GEOTRANSFORM 1
+    #endif
+#endif
+
+class NisarMultilookRasterBand;
+
+// ====================================================================
+// NisarMultilookDataset
+// MULTILOOK=AZxRG: a Float32 view of a layer averaged over AZ rows by
+// RG columns. Complex layers are averaged in the power domain
+// (MULTILOOK_MODE=INTENSITY or AMPLITUDE), real ones directly.
+// ====================================================================
+class NisarMultilookDataset final : public GDALDataset
+{
+    friend class NisarMultilookRasterBand;
+
+private:
+    GDALDataset* m_poSrcDS = nullptr; // Full-resolution layer
+    int m_nLooksAz = 1;
+    int m_nLooksRg = 1;
+    NisarLookMode m_eMode = NisarLookMode::Intensity;
+
+    double m_adfGeoTransform[6] = {0, 1, 0, 0, 0, 1};
+    bool m_bHasGeoTransform = false;
+    int m_nGCPCount = 0;
+    GDAL_GCP* m_pasGCPs = nullptr;
+
+public:
+    NisarMultilookDataset() = default;
+    ~NisarMultilookDataset() override;
+
+    static GDALDataset* Open(GDALOpenInfo* poOpenInfo);
+
+    const OGRSpatialReference* GetSpatialRef() const override;
+    int GetGCPCount() override;
+    const GDAL_GCP* GetGCPs() override;
+    const OGRSpatialReference* GetGCPSpatialRef() const override;
+
+#ifdef USE_LEGACY_GEOTRANSFORM
+    CPLErr GetGeoTransform( double * padfTransform ) override;
+#else
+    CPLErr GetGeoTransform(GDALGeoTransform &gt) const override;
+#endif
+};
+#endif // NISAR_MULTILOOK_H
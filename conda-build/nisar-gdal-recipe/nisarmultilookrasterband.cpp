@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <vector>
+
+#include "nisarmultilookrasterband.h"
+#include "nisarmultilook.h"
+
+// ====================================================================
+// NisarMultilookRasterBand Implementation
+// ====================================================================
+
+NisarMultilookRasterBand::NisarMultilookRasterBand(NisarMultilookDataset* poDSIn, int nBandIn, GDALRasterBand* poSrcBand)
+    : m_poSrcBand(poSrcBand)
+{
+    this->poDS = poDSIn;
+    this->nBand = nBandIn;
+    this->eDataType = GDT_Float32;
+
+    // One block per whole group of source blocks when the looks divide them
+    int nSrcBlockXSize, nSrcBlockYSize;
+    poSrcBand->GetBlockSize(&nSrcBlockXSize, &nSrcBlockYSize);
+    this->nBlockXSize = (nSrcBlockXSize % poDSIn->m_nLooksRg == 0 && nSrcBlockXSize / poDSIn->m_nLooksRg >= 64)
+                            ? nSrcBlockXSize / poDSIn->m_nLooksRg : 256;
+    this->nBlockYSize = (nSrcBlockYSize % poDSIn->m_nLooksAz == 0 && nSrcBlockYSize / poDSIn->m_nLooksAz >= 64)
+                            ? nSrcBlockYSize / poDSIn->m_nLooksAz : 256;
+    this->nBlockXSize = std::min(this->nBlockXSize, poDSIn->GetRasterXSize());
+    this->nBlockYSize = std::min(this->nBlockYSize, poDSIn->GetRasterYSize());
+}
+
+double NisarMultilookRasterBand::GetNoDataValue(int* pbSuccess)
+{
+    return m_poSrcBand->GetNoDataValue(pbSuccess);
+}
+
+CPLErr NisarMultilookRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void* pImage)
+{
+    auto t_start = std::chrono::high_resolution_clock::now();
+
+    NisarMultilookDataset* poGDS = static_cast<NisarMultilookDataset*>(poDS);
+    float* pafOutput = static_cast<float*>(pImage);
+    const int nLooksX = poGDS->m_nLooksRg;
+    const int nLooksY = poGDS->m_nLooksAz;
+
+    const int nXOff = nBlockXOff * nBlockXSize;
+    const int nYOff = nBlockYOff * nBlockYSize;
+    const int nReqXSize = std::min(nBlockXSize, nRasterXSize - nXOff);
+    const int nReqYSize = std::min(nBlockYSize, nRasterYSize - nYOff);
+
+    int bHasNoData = FALSE;
+    const double dfNoData = m_poSrcBand->GetNoDataValue(&bHasNoData);
+    std::fill_n(pafOutput, static_cast<size_t>(nBlockXSize) * nBlockYSize,
+                bHasNoData ? static_cast<float>(dfNoData) : std::numeric_limits<float>::quiet_NaN());
+
+    CPLErr eErr = CE_None;
+    if (GDALDataTypeIsComplex(m_poSrcBand->GetRasterDataType())) {
+        // Power domain: mean |z|^2 (or |z|) per AZ x RG window
+        const int nSrcXSize = nReqXSize * nLooksX;
+        const int nSrcYSize = nReqYSize * nLooksY;
+        std::vector<float> afSrc(static_cast<size_t>(nSrcXSize) * nSrcYSize * 2);
+        eErr = m_poSrcBand->RasterIO(GF_Read, nXOff * nLooksX, nYOff * nLooksY, nSrcXSize, nSrcYSize,
+                                     afSrc.data(), nSrcXSize, nSrcYSize, GDT_CFloat32, 0, 0, nullptr);
+        if (eErr == CE_None) {
+            NisarComplexMultilook(afSrc.data(), static_cast<size_t>(nSrcXSize) * 2, nLooksX, nLooksY, poGDS->m_eMode,
+                                  bHasNoData != FALSE, dfNoData, pafOutput, nReqXSize, nReqYSize, nBlockXSize, 1);
+        }
+    } else {
+        // Real layers (e.g. GCOV backscatter) are already powers: plain box average
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        sExtraArg.eResampleAlg = GRIORA_Average;
+        eErr = m_poSrcBand->RasterIO(GF_Read, nXOff * nLooksX, nYOff * nLooksY, nReqXSize * nLooksX, nReqYSize * nLooksY,
+                                     pafOutput, nReqXSize, nReqYSize, GDT_Float32,
+                                     sizeof(float), static_cast<GSpacing>(sizeof(float)) * nBlockXSize, &sExtraArg);
+    }
+
+    std::chrono::duration<double, std::milli> t_diff = std::chrono::high_resolution_clock::now() - t_start;
+    CPLDebug("NISAR_DRIVER", "Multilook Block(X:%d, Y:%d) | Looks: %dx%d | Time: %.3f ms",
+             nBlockXOff, nBlockYOff, nLooksY, nLooksX, t_diff.count());
+    return eErr;
+}
@@ -0,0 +1,27 @@
+#ifndef NISAR_MULTILOOK_RASTERBAND_H
+#define NISAR_MULTILOOK_RASTERBAND_H
+
+#include "gdal_priv.h"
+
+// Forward declare the dataset so the band knows it exists
+class NisarMultilookDataset;
+
+// ====================================================================
+// NisarMultilookRasterBand
+// Reads the AZ x RG source window of each block and reduces it.
+// ====================================================================
+class NisarMultilookRasterBand final : public GDALRasterBand
+{
+    friend class NisarMultilookDataset;
+
+    GDALRasterBand* m_poSrcBand = nullptr;
+
+public:
+    NisarMultilookRasterBand(NisarMultilookDataset* poDSIn, int nBandIn, GDALRasterBand* poSrcBand);
+    ~NisarMultilookRasterBand() override = default;
+
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void* pImage) override;
+    double GetNoDataValue(int* pbSuccess = nullptr) override;
+};
+
+#endif // NISAR_MULTILOOK_RASTERBAND_H
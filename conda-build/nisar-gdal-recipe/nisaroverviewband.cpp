@@ -0,0 +1,352 @@
+// nisaroverviewband.cpp
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+#include "nisarrasterband.h"
+#include "nisaroverviewband.h"
+
+namespace
+{
+
+template <typename T> bool IsValidSample(T v, bool bHasNoData, T tNoData)
+{
+    if constexpr (std::is_floating_point<T>::value) {
+        if (std::isnan(v)) return false;
+    }
+    return !bHasNoData || v != tNoData;
+}
+
+template <typename T> T NoDataOrNaN(bool bHasNoData, double dfNoData)
+{
+    if (bHasNoData) return static_cast<T>(dfNoData);
+    if constexpr (std::is_floating_point<T>::value) return std::numeric_limits<T>::quiet_NaN();
+    return 0;
+}
+
+// Generic path: nComponents = 2 for complex types, whose pixel is invalid
+// if any component is NaN or its real part equals nodata
+template <typename T, int nComponents>
+void BoxFilterRow(const T* pRow0, const T* pRow1, int nOutPixels, bool bHasNoData, double dfNoData, T* pOut)
+{
+    const bool bNoDataRepresentable = bHasNoData && !std::isnan(dfNoData) &&
+        dfNoData >= static_cast<double>(std::numeric_limits<T>::lowest()) &&
+        dfNoData <= static_cast<double>(std::numeric_limits<T>::max());
+    const T tNoData = bNoDataRepresentable ? static_cast<T>(dfNoData) : T(0);
+    const T tEmpty = NoDataOrNaN<T>(bNoDataRepresentable, dfNoData);
+
+    for (int i = 0; i < nOutPixels; i++) {
+        const T* apSrc[4] = {pRow0 + 2 * i * nComponents, pRow0 + (2 * i + 1) * nComponents,
+                             pRow1 + 2 * i * nComponents, pRow1 + (2 * i + 1) * nComponents};
+        double adfSum[nComponents] = {};
+        int nValid = 0;
+        for (const T* pSrc : apSrc) {
+            bool bValid = IsValidSample(pSrc[0], bNoDataRepresentable, tNoData);
+            for (int c = 1; c < nComponents; c++) bValid = bValid && IsValidSample(pSrc[c], false, tNoData);
+            if (!bValid) continue;
+            for (int c = 0; c < nComponents; c++) adfSum[c] += static_cast<double>(pSrc[c]);
+            nValid++;
+        }
+        for (int c = 0; c < nComponents; c++) {
+            if (nValid == 0) {
+                pOut[i * nComponents + c] = c == 0 ? tEmpty : T(0);
+            } else if constexpr (std::is_floating_point<T>::value) {
+                pOut[i * nComponents + c] = static_cast<T>(adfSum[c] / nValid);
+            } else {
+                pOut[i * nComponents + c] = static_cast<T>(std::floor(adfSum[c] / nValid + 0.5));
+            }
+        }
+    }
+}
+
+// Float32: 8 outputs per iteration, masks built from ordered/nodata compares
+void BoxFilterRowFloat32(const float* pRow0, const float* pRow1, int nOutPixels, bool bHasNoData, double dfNoData,
+                         float* pOut)
+{
+    const bool bNoDataCompare = bHasNoData && !std::isnan(dfNoData);
+    int i = 0;
+#ifdef __AVX2__
+    const __m256 vNoData = _mm256_set1_ps(static_cast<float>(dfNoData));
+    const __m256 vOne = _mm256_set1_ps(1.0f);
+    const __m256 vEmpty = _mm256_set1_ps(NoDataOrNaN<float>(bHasNoData, dfNoData));
+    auto ValidMask = [&](__m256 v) {
+        __m256 vMask = _mm256_cmp_ps(v, v, _CMP_ORD_Q);
+        if (bNoDataCompare) vMask = _mm256_and_ps(vMask, _mm256_cmp_ps(v, vNoData, _CMP_NEQ_OQ));
+        return vMask;
+    };
+    for (; i + 7 < nOutPixels; i += 8) {
+        const __m256 a0 = _mm256_loadu_ps(pRow0 + 2 * i), a1 = _mm256_loadu_ps(pRow0 + 2 * i + 8);
+        const __m256 b0 = _mm256_loadu_ps(pRow1 + 2 * i), b1 = _mm256_loadu_ps(pRow1 + 2 * i + 8);
+        const __m256 ma0 = ValidMask(a0), ma1 = ValidMask(a1), mb0 = ValidMask(b0), mb1 = ValidMask(b1);
+
+        // Vertical sums first, then horizontal pairs
+        const __m256 vSum0 = _mm256_add_ps(_mm256_and_ps(a0, ma0), _mm256_and_ps(b0, mb0));
+        const __m256 vSum1 = _mm256_add_ps(_mm256_and_ps(a1, ma1), _mm256_and_ps(b1, mb1));
+        const __m256 vCnt0 = _mm256_add_ps(_mm256_and_ps(vOne, ma0), _mm256_and_ps(vOne, mb0));
+        const __m256 vCnt1 = _mm256_add_ps(_mm256_and_ps(vOne, ma1), _mm256_and_ps(vOne, mb1));
+
+        // hadd interleaves 128-bit lanes; restore pixel order
+        const __m256 vSum = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_hadd_ps(vSum0, vSum1)), 0xD8));
+        const __m256 vCnt = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_hadd_ps(vCnt0, vCnt1)), 0xD8));
+
+        const __m256 vAvg = _mm256_div_ps(vSum, vCnt);
+        const __m256 vNone = _mm256_cmp_ps(vCnt, _mm256_setzero_ps(), _CMP_EQ_OQ);
+        _mm256_storeu_ps(pOut + i, _mm256_blendv_ps(vAvg, vEmpty, vNone));
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    const float32x4_t vNoData = vdupq_n_f32(static_cast<float>(dfNoData));
+    const float32x4_t vOne = vdupq_n_f32(1.0f);
+    const float32x4_t vEmpty = vdupq_n_f32(NoDataOrNaN<float>(bHasNoData, dfNoData));
+    auto ValidMask = [&](float32x4_t v) {
+        uint32x4_t vMask = vceqq_f32(v, v);
+        if (bNoDataCompare) vMask = vandq_u32(vMask, vmvnq_u32(vceqq_f32(v, vNoData)));
+        return vMask;
+    };
+    auto Masked = [](float32x4_t v, uint32x4_t vMask) {
+        return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v), vMask));
+    };
+    for (; i + 3 < nOutPixels; i += 4) {
+        const float32x4_t a0 = vld1q_f32(pRow0 + 2 * i), a1 = vld1q_f32(pRow0 + 2 * i + 4);
+        const float32x4_t b0 = vld1q_f32(pRow1 + 2 * i), b1 = vld1q_f32(pRow1 + 2 * i + 4);
+        const uint32x4_t ma0 = ValidMask(a0), ma1 = ValidMask(a1), mb0 = ValidMask(b0), mb1 = ValidMask(b1);
+
+        const float32x4_t vSum0 = vaddq_f32(Masked(a0, ma0), Masked(b0, mb0));
+        const float32x4_t vSum1 = vaddq_f32(Masked(a1, ma1), Masked(b1, mb1));
+        const float32x4_t vCnt0 = vaddq_f32(Masked(vOne, ma0), Masked(vOne, mb0));
+        const float32x4_t vCnt1 = vaddq_f32(Masked(vOne, ma1), Masked(vOne, mb1));
+
+        // Pairwise add keeps pixel order on AArch64
+        const float32x4_t vSum = vpaddq_f32(vSum0, vSum1);
+        const float32x4_t vCnt = vpaddq_f32(vCnt0, vCnt1);
+        const uint32x4_t vNone = vceqq_f32(vCnt, vdupq_n_f32(0.0f));
+        vst1q_f32(pOut + i, vbslq_f32(vNone, vEmpty, vdivq_f32(vSum, vCnt)));
+    }
+#endif
+    // Scalar tail
+    if (i < nOutPixels) BoxFilterRow<float, 1>(pRow0 + 2 * i, pRow1 + 2 * i, nOutPixels - i, bHasNoData, dfNoData, pOut + i);
+}
+
+// |z|^2 (or |z|) of nPixels interleaved CFloat32 samples; invalid samples become NaN
+void ComplexRowToPower(const float* pafSrc, int nPixels, NisarLookMode eMode, bool bHasNoData, double dfNoData,
+                       float* pafPower)
+{
+    const bool bNoDataCompare = bHasNoData && !std::isnan(dfNoData);
+    const float fNoData = static_cast<float>(dfNoData);
+    const bool bAmplitude = eMode == NisarLookMode::Amplitude;
+    int i = 0;
+#ifdef __AVX2__
+    const __m256 vNaN = _mm256_set1_ps(std::numeric_limits<float>::quiet_NaN());
+    const __m256 vNoData = _mm256_set1_ps(fNoData);
+    for (; i + 7 < nPixels; i += 8) {
+        const __m256 v0 = _mm256_loadu_ps(pafSrc + 2 * i), v1 = _mm256_loadu_ps(pafSrc + 2 * i + 8);
+        // re^2 + im^2 per pixel; hadd interleaves lanes, the permute restores order
+        __m256 vPow = _mm256_hadd_ps(_mm256_mul_ps(v0, v0), _mm256_mul_ps(v1, v1));
+        vPow = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(vPow), 0xD8));
+        if (bAmplitude) vPow = _mm256_sqrt_ps(vPow);
+        if (bNoDataCompare) {
+            // Real parts: even floats of v0/v1
+            __m256 vRe = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+            vRe = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(vRe), 0xD8));
+            vPow = _mm256_blendv_ps(vPow, vNaN, _mm256_cmp_ps(vRe, vNoData, _CMP_EQ_OQ));
+        }
+        // A NaN component already propagates into vPow
+        _mm256_storeu_ps(pafPower + i, vPow);
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    const float32x4_t vNaN = vdupq_n_f32(std::numeric_limits<float>::quiet_NaN());
+    const float32x4_t vNoData = vdupq_n_f32(fNoData);
+    for (; i + 3 < nPixels; i += 4) {
+        // vld2q de-interleaves real and imaginary parts
+        const float32x4x2_t v = vld2q_f32(pafSrc + 2 * i);
+        float32x4_t vPow = vmlaq_f32(vmulq_f32(v.val[0], v.val[0]), v.val[1], v.val[1]);
+        if (bAmplitude) vPow = vsqrtq_f32(vPow);
+        if (bNoDataCompare) vPow = vbslq_f32(vceqq_f32(v.val[0], vNoData), vNaN, vPow);
+        vst1q_f32(pafPower + i, vPow);
+    }
+#endif
+    for (; i < nPixels; i++) {
+        const float fRe = pafSrc[2 * i], fIm = pafSrc[2 * i + 1];
+        if (bNoDataCompare && fRe == fNoData) {
+            pafPower[i] = std::numeric_limits<float>::quiet_NaN();
+            continue;
+        }
+        const float fPow = fRe * fRe + fIm * fIm;
+        pafPower[i] = bAmplitude ? std::sqrt(fPow) : fPow;
+    }
+}
+
+}  // namespace
+
+NisarLookMode NisarGetComplexLookMode(const char* pszMode)
+{
+    if (pszMode && EQUAL(pszMode, "AVERAGE")) return NisarLookMode::Average;
+    if (pszMode && EQUAL(pszMode, "AMPLITUDE")) return NisarLookMode::Amplitude;
+    return NisarLookMode::Intensity;
+}
+
+void NisarComplexMultilook(const float* pafSrc, size_t nSrcLineStride, int nLooksX, int nLooksY,
+                           NisarLookMode eMode, bool bHasNoData, double dfNoData,
+                           float* pafDst, int nDstXSize, int nDstYSize, size_t nDstLineStride, int nDstPixelStride)
+{
+    const int nSrcXSize = nDstXSize * nLooksX;
+    const float fEmpty = NoDataOrNaN<float>(bHasNoData && !std::isnan(dfNoData), dfNoData);
+    thread_local std::vector<float> tls_afPower;
+    thread_local std::vector<double> tls_adfSum;
+    thread_local std::vector<int> tls_anCount;
+    tls_afPower.resize(nSrcXSize);
+
+    for (int nY = 0; nY < nDstYSize; nY++) {
+        tls_adfSum.assign(nDstXSize, 0.0);
+        tls_anCount.assign(nDstXSize, 0);
+        for (int iLook = 0; iLook < nLooksY; iLook++) {
+            ComplexRowToPower(pafSrc + (static_cast<size_t>(nY) * nLooksY + iLook) * nSrcLineStride, nSrcXSize, eMode,
+                              bHasNoData, dfNoData, tls_afPower.data());
+            for (int nX = 0; nX < nDstXSize; nX++) {
+                const float* pafLooks = tls_afPower.data() + static_cast<size_t>(nX) * nLooksX;
+                for (int k = 0; k < nLooksX; k++) {
+                    if (std::isnan(pafLooks[k])) continue;
+                    tls_adfSum[nX] += pafLooks[k];
+                    tls_anCount[nX]++;
+                }
+            }
+        }
+        float* pafRow = pafDst + static_cast<size_t>(nY) * nDstLineStride;
+        for (int nX = 0; nX < nDstXSize; nX++) {
+            pafRow[static_cast<size_t>(nX) * nDstPixelStride] =
+                tls_anCount[nX] ? static_cast<float>(tls_adfSum[nX] / tls_anCount[nX]) : fEmpty;
+        }
+    }
+}
+
+void NisarBoxFilter2x2(const GByte* pabyRow0, const GByte* pabyRow1, int nOutPixels, GDALDataType eDT,
+                       bool bHasNoData, double dfNoData, GByte* pabyOut)
+{
+#define NISAR_BOX(T, C) \
+    BoxFilterRow<T, C>(reinterpret_cast<const T*>(pabyRow0), reinterpret_cast<const T*>(pabyRow1), nOutPixels, \
+                       bHasNoData, dfNoData, reinterpret_cast<T*>(pabyOut))
+    switch (eDT) {
+        case GDT_Byte: NISAR_BOX(uint8_t, 1); break;
+        case GDT_Int16: NISAR_BOX(int16_t, 1); break;
+        case GDT_UInt16: NISAR_BOX(uint16_t, 1); break;
+        case GDT_Int32: NISAR_BOX(int32_t, 1); break;
+        case GDT_UInt32: NISAR_BOX(uint32_t, 1); break;
+        case GDT_Float32:
+            BoxFilterRowFloat32(reinterpret_cast<const float*>(pabyRow0), reinterpret_cast<const float*>(pabyRow1),
+                                nOutPixels, bHasNoData, dfNoData, reinterpret_cast<float*>(pabyOut));
+            break;
+        case GDT_Float64: NISAR_BOX(double, 1); break;
+        case GDT_CInt16: NISAR_BOX(int16_t, 2); break;
+        case GDT_CInt32: NISAR_BOX(int32_t, 2); break;
+        case GDT_CFloat32: NISAR_BOX(float, 2); break;
+        case GDT_CFloat64: NISAR_BOX(double, 2); break;
+        default: {
+            // Anything else: nearest sample
+            const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+            for (int i = 0; i < nOutPixels; i++) memcpy(pabyOut + i * nDTSize, pabyRow0 + 2 * i * nDTSize, nDTSize);
+            break;
+        }
+    }
+#undef NISAR_BOX
+}
+
+/***************************************************************************/
+/*                          ReadCascadedBlock()                            */
+/* Builds an overview block from the 2x2 source blocks of the next finer   */
+/* level. Those come from the GDAL block cache (or are computed there and  */
+/* then), so a zoom-out sweep reads each base pixel once: about 1.33x the  */
+/* base read for the whole pyramid.                                        */
+/***************************************************************************/
+CPLErr NisarOverviewBand::ReadCascadedBlock(int nBlockXOff, int nBlockYOff, void* pImage)
+{
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    const int nPixelSize = GDALGetDataTypeSizeBytes(eDataType);
+    int nSrcBlockXSize, nSrcBlockYSize;
+    m_poSourceBand->GetBlockSize(&nSrcBlockXSize, &nSrcBlockYSize);
+    const int nSrcBlocksX = (m_poSourceBand->GetXSize() + nSrcBlockXSize - 1) / nSrcBlockXSize;
+    const int nSrcBlocksY = (m_poSourceBand->GetYSize() + nSrcBlockYSize - 1) / nSrcBlockYSize;
+
+    int bHasNoData = FALSE;
+    const double dfNoData = m_poBaseBand->GetNoDataValue(&bHasNoData);
+
+    const int nHalfX = nBlockXSize / 2;
+    const int nHalfY = nBlockYSize / 2;
+    const size_t nLineBytes = static_cast<size_t>(nBlockXSize) * nPixelSize;
+    const size_t nSrcLineBytes = static_cast<size_t>(nSrcBlockXSize) * nPixelSize;
+
+    for (int iQY = 0; iQY < 2; iQY++) {
+        for (int iQX = 0; iQX < 2; iQX++) {
+            const int nSrcBX = nBlockXOff * 2 + iQX;
+            const int nSrcBY = nBlockYOff * 2 + iQY;
+            if (nSrcBX >= nSrcBlocksX || nSrcBY >= nSrcBlocksY) continue;
+
+            GDALRasterBlock* poSrcBlock = m_poSourceBand->GetLockedBlockRef(nSrcBX, nSrcBY);
+            if (poSrcBlock == nullptr) return CE_Failure;
+            const GByte* pabySrc = static_cast<const GByte*>(poSrcBlock->GetDataRef());
+
+            // Source blocks match this band's block size, so each fills one quadrant
+            GByte* pabyDst = static_cast<GByte*>(pImage) + iQY * nHalfY * nLineBytes + iQX * nHalfX * nPixelSize;
+            const int nOutRows = std::min(nHalfY, nSrcBlockYSize / 2);
+            const int nOutCols = std::min(nHalfX, nSrcBlockXSize / 2);
+            for (int y = 0; y < nOutRows; y++) {
+                NisarBoxFilter2x2(pabySrc + (2 * y) * nSrcLineBytes, pabySrc + (2 * y + 1) * nSrcLineBytes, nOutCols,
+                                  eDataType, bHasNoData != FALSE, dfNoData, pabyDst + y * nLineBytes);
+            }
+            poSrcBlock->DropLock();
+        }
+    }
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start_time;
+    CPLDebug("NISAR_OVERVIEW", "Cascaded block [%d, %d] | Decimation: %d | Time: %.2f ms",
+             nBlockXOff, nBlockYOff, m_nDecimationFactor, elapsed.count());
+    return CE_None;
+}
+
+/***************************************************************************/
+/*                           ReadComplexLooks()                            */
+/* Reads a CFloat32 base window at full resolution and reduces it in the   */
+/* power domain into the real parts of pabyDst (imaginary parts stay 0).   */
+/* Callers hold the overview-routing bypass.                               */
+/***************************************************************************/
+CPLErr NisarOverviewBand::ReadComplexLooks(int nXOff, int nYOff, int nXSize, int nYSize, int nLooksX, int nLooksY,
+                                           GByte* pabyDst, int nDstXSize, int nDstYSize)
+{
+    nDstXSize = std::min(nDstXSize, nXSize / nLooksX);
+    nDstYSize = std::min(nDstYSize, nYSize / nLooksY);
+    if (nDstXSize <= 0 || nDstYSize <= 0) return CE_None;
+
+    const int nSrcXSize = nDstXSize * nLooksX;
+    const int nSrcYSize = nDstYSize * nLooksY;
+    std::vector<float> afSrc(static_cast<size_t>(nSrcXSize) * nSrcYSize * 2);
+    CPLErr eErr = m_poBaseBand->RasterIO(GF_Read, nXOff, nYOff, nSrcXSize, nSrcYSize, afSrc.data(),
+                                         nSrcXSize, nSrcYSize, GDT_CFloat32, 0, 0, nullptr);
+    if (eErr != CE_None) return eErr;
+
+    int bHasNoData = FALSE;
+    const double dfNoData = m_poBaseBand->GetNoDataValue(&bHasNoData);
+    NisarComplexMultilook(afSrc.data(), static_cast<size_t>(nSrcXSize) * 2, nLooksX, nLooksY, m_eLookMode,
+                          bHasNoData != FALSE, dfNoData, reinterpret_cast<float*>(pabyDst), nDstXSize, nDstYSize,
+                          static_cast<size_t>(nBlockXSize) * 2, 2);
+    return CE_None;
+}
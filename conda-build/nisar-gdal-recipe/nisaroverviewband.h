@@ -6,14 +6,44 @@
 #include <cstring>   // For memset
 #include <chrono>    // For timing instrumentation
 
+/***************************************************************************/
+/* Power-domain multilooking of CFloat32 samples: each output is the mean  */
+/* |z|^2 (INTENSITY) or mean |z| (AMPLITUDE) of an nLooksY x nLooksX       */
+/* window, so random phase does not cancel energy. Samples with a NaN     */
+/* component or a real part equal to nodata are left out; an empty window  */
+/* yields nodata, or NaN when there is none. Strides are in floats, so     */
+/* pafDst can be a Float32 raster or the real parts of a CFloat32 one.     */
+/***************************************************************************/
+enum class NisarLookMode { Average, Intensity, Amplitude };
+
+NisarLookMode NisarGetComplexLookMode(const char* pszMode);
+
+void NisarComplexMultilook(const float* pafSrc, size_t nSrcLineStride, int nLooksX, int nLooksY,
+                           NisarLookMode eMode, bool bHasNoData, double dfNoData,
+                           float* pafDst, int nDstXSize, int nDstYSize, size_t nDstLineStride, int nDstPixelStride);
+
 class NisarOverviewBand final : public GDALRasterBand
 {
     GDALRasterBand* m_poBaseBand;
     int m_nDecimationFactor;
+    int m_nSampleDensity; // 0: full read; else base blocks sampled per block axis
+    // Next finer level (the base band for 1:2). Its cached blocks feed a
+    // 2x2 box filter, so each level costs a quarter of the one above it.
+    GDALRasterBand* m_poSourceBand;
+    // Level of a persisted overview cache (NISAR_OVR_CACHE_DIR), once attached
+    GDALRasterBand* m_poCacheBand = nullptr;
+    // CFloat32 bases: mean |z|^2 or |z| in the real part (NISAR_COMPLEX_OVR)
+    NisarLookMode m_eLookMode = NisarLookMode::Average;
+
+    CPLErr ReadCascadedBlock(int nBlockXOff, int nBlockYOff, void* pImage);
+    CPLErr ReadComplexLooks(int nXOff, int nYOff, int nXSize, int nYSize, int nLooksX, int nLooksY,
+                            GByte* pabyDst, int nDstXSize, int nDstYSize);
 
 public:
-    NisarOverviewBand(GDALRasterBand* poBaseBand, int nDecimationFactor)
-        : m_poBaseBand(poBaseBand), m_nDecimationFactor(nDecimationFactor)
+    NisarOverviewBand(GDALRasterBand* poBaseBand, int nDecimationFactor, int nSampleDensity = 0,
+                      GDALRasterBand* poSourceBand = nullptr)
+        : m_poBaseBand(poBaseBand), m_nDecimationFactor(nDecimationFactor), m_nSampleDensity(nSampleDensity),
+          m_poSourceBand(poSourceBand)
     {
         this->poDS = poBaseBand->GetDataset();
         this->nBand = poBaseBand->GetBand();
@@ -29,8 +59,82 @@ public:
         this->nBlockXSize = nBaseBlockXSize;
         this->nBlockYSize = nBaseBlockYSize;
 
-        CPLDebug("NISAR_OVERVIEW", "Created Overview Band | Decimation: %d | Size: %dx%d | Block: %dx%d", 
-                 m_nDecimationFactor, this->nRasterXSize, this->nRasterYSize, this->nBlockXSize, this->nBlockYSize);
+        if (eDataType == GDT_CFloat32) {
+            const char* pszMode = CPLGetConfigOption("NISAR_COMPLEX_OVR", "INTENSITY");
+            m_eLookMode = NisarGetComplexLookMode(pszMode);
+            if (m_eLookMode != NisarLookMode::Average)
+                SetMetadataItem("OVERVIEW_COMPLEX_MODE", m_eLookMode == NisarLookMode::Amplitude ? "AMPLITUDE" : "INTENSITY");
+        }
+
+        // Sampled levels are previews, not averages of every pixel
+        if (m_nSampleDensity > 0) {
+            SetMetadataItem("OVERVIEW_METHOD", "CHUNK_SAMPLED");
+            SetMetadataItem("OVERVIEW_SAMPLING_DENSITY", CPLSPrintf("%d", m_nSampleDensity));
+        }
+
+        CPLDebug("NISAR_OVERVIEW", "Created Overview Band | Decimation: %d | Size: %dx%d | Block: %dx%d%s", 
+                 m_nDecimationFactor, this->nRasterXSize, this->nRasterYSize, this->nBlockXSize, this->nBlockYSize,
+                 m_nSampleDensity > 0 ? " | Sampled" : "");
+    }
+
+    // Sampled mode: the block is split into DENSITY x DENSITY tiles. Each tile
+    // stands for a group of base blocks and is filled from the group's
+    // centre block alone, box-averaged down to the tile size. Only
+    // DENSITY^2 base blocks are read instead of FACTOR^2.
+    CPLErr ReadSampledBlock(int nBlockXOff, int nBlockYOff, void* pImage)
+    {
+        const int nPixelSize = GDALGetDataTypeSizeBytes(eDataType);
+        int nBaseBlockXSize, nBaseBlockYSize;
+        m_poBaseBand->GetBlockSize(&nBaseBlockXSize, &nBaseBlockYSize);
+
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        sExtraArg.eResampleAlg = GRIORA_Average;
+
+        struct SampledReadGuard {
+            SampledReadGuard() { NisarRasterBand::bDisableOverviewRouting = true; NisarRasterBand::bDisablePrefetch = true; }
+            ~SampledReadGuard() { NisarRasterBand::bDisableOverviewRouting = false; NisarRasterBand::bDisablePrefetch = false; }
+        };
+        SampledReadGuard oGuard;
+
+        int nBlocksRead = 0;
+        CPLErr eErr = CE_None;
+        for (int iTY = 0; iTY < m_nSampleDensity && eErr == CE_None; iTY++) {
+            // Tile extent in overview pixels, clipped to the overview raster
+            const int nOY0 = nBlockYOff * nBlockYSize + iTY * nBlockYSize / m_nSampleDensity;
+            const int nOY1 = std::min(nBlockYOff * nBlockYSize + (iTY + 1) * nBlockYSize / m_nSampleDensity, nRasterYSize);
+            if (nOY1 <= nOY0) continue;
+            for (int iTX = 0; iTX < m_nSampleDensity && eErr == CE_None; iTX++) {
+                const int nOX0 = nBlockXOff * nBlockXSize + iTX * nBlockXSize / m_nSampleDensity;
+                const int nOX1 = std::min(nBlockXOff * nBlockXSize + (iTX + 1) * nBlockXSize / m_nSampleDensity, nRasterXSize);
+                if (nOX1 <= nOX0) continue;
+
+                // The base block under the centre of the tile
+                const int nBaseBX = ((nOX0 + nOX1) / 2 * m_nDecimationFactor) / nBaseBlockXSize;
+                const int nBaseBY = ((nOY0 + nOY1) / 2 * m_nDecimationFactor) / nBaseBlockYSize;
+                const int nXOff = nBaseBX * nBaseBlockXSize;
+                const int nYOff = nBaseBY * nBaseBlockYSize;
+                const int nXSize = std::min(nBaseBlockXSize, m_poBaseBand->GetXSize() - nXOff);
+                const int nYSize = std::min(nBaseBlockYSize, m_poBaseBand->GetYSize() - nYOff);
+                if (nXSize <= 0 || nYSize <= 0) continue;
+
+                GByte* pabyTile = static_cast<GByte*>(pImage) +
+                    (static_cast<size_t>(nOY0 - nBlockYOff * nBlockYSize) * nBlockXSize + (nOX0 - nBlockXOff * nBlockXSize)) * nPixelSize;
+                nBlocksRead++;
+                if (m_eLookMode != NisarLookMode::Average) {
+                    eErr = ReadComplexLooks(nXOff, nYOff, nXSize, nYSize, std::max(1, nXSize / (nOX1 - nOX0)),
+                                            std::max(1, nYSize / (nOY1 - nOY0)), pabyTile, nOX1 - nOX0, nOY1 - nOY0);
+                    continue;
+                }
+                eErr = m_poBaseBand->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize,
+                                              pabyTile, nOX1 - nOX0, nOY1 - nOY0, eDataType,
+                                              nPixelSize, static_cast<GSpacing>(nPixelSize) * nBlockXSize, &sExtraArg);
+            }
+        }
+
+        CPLDebug("NISAR_OVERVIEW", "Sampled block [%d, %d] | Decimation: %d | Base blocks read: %d of up to %d",
+                 nBlockXOff, nBlockYOff, m_nDecimationFactor, nBlocksRead, m_nDecimationFactor * m_nDecimationFactor);
+        return eErr;
     }
 
     // Intercept the block read and map it down to the base resolution
@@ -47,6 +151,21 @@ public:
         size_t nBytesToZero = static_cast<size_t>(nBlockXSize) * nBlockYSize * nPixelSize;
         memset(pImage, 0, nBytesToZero);
 
+        if (m_poCacheBand) {
+            const int nValidX = std::min(nBlockXSize, std::min(nRasterXSize, m_poCacheBand->GetXSize()) - nBlockXOff * nBlockXSize);
+            const int nValidY = std::min(nBlockYSize, std::min(nRasterYSize, m_poCacheBand->GetYSize()) - nBlockYOff * nBlockYSize);
+            if (nValidX <= 0 || nValidY <= 0) return CE_None;
+            return m_poCacheBand->RasterIO(GF_Read, nBlockXOff * nBlockXSize, nBlockYOff * nBlockYSize, nValidX, nValidY,
+                                           pImage, nValidX, nValidY, eDataType, nPixelSize,
+                                           static_cast<GSpacing>(nPixelSize) * nBlockXSize, nullptr);
+        }
+
+        if (m_nSampleDensity > 0) return ReadSampledBlock(nBlockXOff, nBlockYOff, pImage);
+        // Power-domain levels reduce the complex base once, then cascade on real parts
+        if (m_poSourceBand && nBlockXSize % 2 == 0 && nBlockYSize % 2 == 0 &&
+            (m_eLookMode == NisarLookMode::Average || m_poSourceBand != m_poBaseBand))
+            return ReadCascadedBlock(nBlockXOff, nBlockYOff, pImage);
+
         // 1. Calculate the bounding box of this overview block in the BASE resolution
         int nXOff = nBlockXOff * nBlockXSize * m_nDecimationFactor;
         int nYOff = nBlockYOff * nBlockYSize * m_nDecimationFactor;
@@ -82,6 +201,11 @@ public:
         
         OverviewBypassGuard oGuard; // Blindfold ON
 
+        if (m_eLookMode != NisarLookMode::Average) {
+            return ReadComplexLooks(nXOff, nYOff, nXSize, nYSize, m_nDecimationFactor, m_nDecimationFactor,
+                                    static_cast<GByte*>(pImage), nBufXSize, nBufYSize);
+        }
+
         // 5. Fire the request. The Base Band is now forced to read raw chunks!
         CPLErr eErr = m_poBaseBand->RasterIO(
             GF_Read,
@@ -101,6 +225,24 @@ public:
 
         return eErr;
     }
+
+    int GetDecimationFactor() const { return m_nDecimationFactor; }
+    void SetCacheBand(GDALRasterBand* poCacheBand) { m_poCacheBand = poCacheBand; }
+
+    // Averaged pixels honour the base band's nodata value
+    virtual double GetNoDataValue(int* pbSuccess = nullptr) override
+    {
+        return m_poBaseBand->GetNoDataValue(pbSuccess);
+    }
 };
 
+/***************************************************************************/
+/* 2x2 box filter over one output row. pabyRow0/pabyRow1 hold 2*nOutPixels */
+/* source pixels each. NaN and nodata inputs are left out of the average;  */
+/* an output with no valid input is set to nodata (NaN when there is none).*/
+/* Complex types are averaged per component.                               */
+/***************************************************************************/
+void NisarBoxFilter2x2(const GByte* pabyRow0, const GByte* pabyRow1, int nOutPixels, GDALDataType eDT,
+                       bool bHasNoData, double dfNoData, GByte* pabyOut);
+
 #endif // NISAR_OVERVIEW_BAND_H
@@ -0,0 +1,259 @@
+// nisaroverviewcache.cpp
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#include "nisaroverviewcache.h"
+
+#include <algorithm>
+#include <ctime>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include "nisarrasterband.h"
+#include "nisaroverviewband.h"
+
+namespace NisarOverviewCache
+{
+
+static std::atomic<int> g_nActiveBuilds{0};
+
+std::string GetCacheDirectory()
+{
+    const char *pszDir = CPLGetConfigOption("NISAR_OVR_CACHE_DIR", "");
+    return pszDir ? std::string(pszDir) : std::string();
+}
+
+int GetMinFactor()
+{
+    return std::max(2, atoi(CPLGetConfigOption("NISAR_OVR_CACHE_MIN_FACTOR", "4")));
+}
+
+std::string BuildIdentity(const std::string &osRawPath, const std::string &osDatasetDesc, int nBand,
+                          int nXSize, int nYSize, GDALDataType eDT, bool bLevelSettings)
+{
+    VSIStatBufL sStat;
+    GUIntBig nSize = 0, nMTime = 0;
+    if (VSIStatL(osRawPath.c_str(), &sStat) == 0) {
+        nSize = static_cast<GUIntBig>(sStat.st_size);
+        nMTime = static_cast<GUIntBig>(sStat.st_mtime);
+    }
+    std::string osIdentity = CPLSPrintf("%s|" CPL_FRMT_GUIB "|" CPL_FRMT_GUIB "|%s|%d|%dx%d|%s", osRawPath.c_str(),
+                                        nSize, nMTime, osDatasetDesc.c_str(), nBand, nXSize, nYSize,
+                                        GDALGetDataTypeName(eDT));
+    if (!bLevelSettings) return osIdentity;
+
+    // The settings that pick the levels and how they are reduced: complex
+    // levels differ with the power-domain mode, sampled levels hold
+    // chunk-sampled previews
+    const char *pszLookMode = GDALDataTypeIsComplex(eDT) ? CPLGetConfigOption("NISAR_COMPLEX_OVR", "INTENSITY") : "";
+    const int nMaxVirtual = atoi(CPLGetConfigOption("NISAR_MAX_VIRTUAL_OVR", "16"));
+    const int nSampledMinFactor = atoi(CPLGetConfigOption("NISAR_OVR_SAMPLED_MIN_FACTOR", "0"));
+    const int nSampleDensity = std::max(1, atoi(CPLGetConfigOption("NISAR_OVR_SAMPLING_DENSITY", "4")));
+    return osIdentity + CPLSPrintf("|%d|%s|%d|%d,%d", GetMinFactor(), pszLookMode, nMaxVirtual, nSampledMinFactor,
+                                   nSampledMinFactor > 0 ? nSampleDensity : 0);
+}
+
+GUInt64 HashIdentity(const std::string &osIdentity)
+{
+    // FNV-1a, as for the open footprints: stable across builds and hosts
+    GUInt64 nHash = 1469598103934665603ULL;
+    for (unsigned char c : osIdentity) {
+        nHash ^= c;
+        nHash *= 1099511628211ULL;
+    }
+    return nHash;
+}
+
+std::string GetSidecarPath(const std::string &osDir, const std::string &osIdentity)
+{
+    return CPLFormFilename(osDir.c_str(), CPLSPrintf("nisar_ovr_%016llx",
+                           static_cast<unsigned long long>(HashIdentity(osIdentity))), "tif");
+}
+
+GDALDataset *OpenSidecar(const std::string &osPath, const std::string &osIdentity, int nLevels)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osPath.c_str(), &sStat) != 0) return nullptr;
+
+    const char *const apszDrivers[] = {"GTiff", nullptr};
+    GDALDataset *poDS = GDALDataset::Open(osPath.c_str(), GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_INTERNAL,
+                                          apszDrivers, nullptr, nullptr);
+    bool bValid = poDS != nullptr && poDS->GetRasterCount() == 1;
+    if (bValid) {
+        const char *pszIdentity = poDS->GetMetadataItem("NISAR_OVR_IDENTITY");
+        const char *pszComplete = poDS->GetMetadataItem("NISAR_OVR_COMPLETE");
+        bValid = pszIdentity && osIdentity == pszIdentity && pszComplete && EQUAL(pszComplete, "YES") &&
+                 poDS->GetRasterBand(1)->GetOverviewCount() == nLevels - 1;
+    }
+    if (bValid) return poDS;
+
+    // Left in place: it may be valid for another process; a rebuild
+    // replaces it through the rename
+    CPLDebug("NISAR_OVERVIEW", "Ignoring mismatching overview cache %s.", osPath.c_str());
+    if (poDS) GDALClose(poDS);
+    return nullptr;
+}
+
+bool IsBuildInProgress(const std::string &osPath)
+{
+    const std::string osDir = CPLGetPath(osPath.c_str());
+    const std::string osPrefix = std::string(CPLGetFilename(osPath.c_str())) + ".";
+    const int nStaleSeconds = atoi(CPLGetConfigOption("NISAR_OVR_CACHE_STALE_SECONDS", "3600"));
+
+    bool bInProgress = false;
+    char **papszFiles = VSIReadDir(osDir.c_str());
+    for (int i = 0; papszFiles && papszFiles[i]; i++) {
+        const std::string osName = papszFiles[i];
+        if (osName.compare(0, osPrefix.size(), osPrefix) != 0 || !EQUAL(CPLGetExtension(osName.c_str()), "partial")) continue;
+
+        const std::string osPartial = CPLFormFilename(osDir.c_str(), osName.c_str(), nullptr);
+        VSIStatBufL sStat;
+        if (VSIStatL(osPartial.c_str(), &sStat) != 0) continue;
+        if (time(nullptr) - sStat.st_mtime > nStaleSeconds) {
+            // Left behind by a crashed or killed build
+            CPLDebug("NISAR_OVERVIEW", "Removing abandoned partial overview cache %s.", osPartial.c_str());
+            VSIUnlink(osPartial.c_str());
+        } else {
+            bInProgress = true;
+        }
+    }
+    CSLDestroy(papszFiles);
+    return bInProgress;
+}
+
+bool TryAcquireBuildSlot()
+{
+    const int nMax = std::max(1, atoi(CPLGetConfigOption("NISAR_OVR_CACHE_MAX_BUILDS", "1")));
+    int nActive = g_nActiveBuilds.load();
+    while (nActive < nMax) {
+        if (g_nActiveBuilds.compare_exchange_weak(nActive, nActive + 1)) return true;
+    }
+    return false;
+}
+
+void ReleaseBuildSlot()
+{
+    g_nActiveBuilds--;
+}
+
+bool BuildSidecar(const std::string &osGranule, CSLConstList papszOpenOptions, int nBand,
+                  const std::string &osPath, const std::string &osIdentity, const std::atomic<bool> *pbStop)
+{
+    // The private open must not start a build of its own
+    CPLSetThreadLocalConfigOption("NISAR_OVR_CACHE_DIR", "");
+    CPLSetThreadLocalConfigOption("COMPRESS_OVERVIEW", "DEFLATE");
+
+    const char *const apszDrivers[] = {"NISAR", nullptr};
+    GDALDataset *poSrcDS = GDALDataset::Open(osGranule.c_str(), GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_INTERNAL,
+                                             apszDrivers, papszOpenOptions, nullptr);
+    GDALRasterBand *poSrcBand = poSrcDS ? poSrcDS->GetRasterBand(nBand) : nullptr;
+    if (!poSrcBand) {
+        if (poSrcDS) GDALClose(poSrcDS);
+        return false;
+    }
+
+    // The cached levels, finest first
+    const int nMinFactor = GetMinFactor();
+    std::vector<NisarOverviewBand *> apoLevels;
+    for (int i = 0; i < poSrcBand->GetOverviewCount(); i++) {
+        auto poLevel = static_cast<NisarOverviewBand *>(poSrcBand->GetOverview(i));
+        if (poLevel && poLevel->GetDecimationFactor() >= nMinFactor) apoLevels.push_back(poLevel);
+    }
+    GDALDriver *poGTiff = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (apoLevels.empty() || !poGTiff) {
+        GDALClose(poSrcDS);
+        return false;
+    }
+
+    const std::string osPartial = osPath + CPLSPrintf(".%d.partial", CPLGetPID());
+    CPLStringList aosCreate;
+    aosCreate.SetNameValue("TILED", "YES");
+    aosCreate.SetNameValue("BLOCKXSIZE", "256");
+    aosCreate.SetNameValue("BLOCKYSIZE", "256");
+    aosCreate.SetNameValue("COMPRESS", "DEFLATE");
+    aosCreate.SetNameValue("BIGTIFF", "IF_SAFER");
+    const GDALDataType eDT = poSrcBand->GetRasterDataType();
+    GDALDataset *poDstDS = poGTiff->Create(osPartial.c_str(), apoLevels[0]->GetXSize(), apoLevels[0]->GetYSize(), 1,
+                                           eDT, aosCreate.List());
+    if (!poDstDS) {
+        GDALClose(poSrcDS);
+        return false;
+    }
+
+    int bHasNoData = FALSE;
+    const double dfNoData = poSrcBand->GetNoDataValue(&bHasNoData);
+    if (bHasNoData) poDstDS->GetRasterBand(1)->SetNoDataValue(dfNoData);
+
+    bool bOK = true;
+    if (apoLevels.size() > 1) {
+        std::vector<int> anFactors;
+        for (size_t i = 1; i < apoLevels.size(); i++)
+            anFactors.push_back(apoLevels[i]->GetDecimationFactor() / apoLevels[0]->GetDecimationFactor());
+        bOK = poDstDS->BuildOverviews("NONE", static_cast<int>(anFactors.size()), anFactors.data(), 0, nullptr,
+                                      nullptr, nullptr) == CE_None;
+    }
+
+    // Progress is reported in NISAR_OVR_CACHE_PROGRESS_STEP percent steps
+    GIntBig nTotalPixels = 0, nDonePixels = 0;
+    for (auto poLevel : apoLevels) nTotalPixels += static_cast<GIntBig>(poLevel->GetXSize()) * poLevel->GetYSize();
+    const int nProgressStep = std::max(1, atoi(CPLGetConfigOption("NISAR_OVR_CACHE_PROGRESS_STEP", "10")));
+    int nNextReport = nProgressStep;
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    for (size_t iLevel = 0; bOK && iLevel < apoLevels.size(); iLevel++) {
+        GDALRasterBand *poSrc = apoLevels[iLevel];
+        GDALRasterBand *poDst = iLevel == 0 ? poDstDS->GetRasterBand(1)
+                                            : poDstDS->GetRasterBand(1)->GetOverview(static_cast<int>(iLevel) - 1);
+        if (!poDst) { bOK = false; break; }
+
+        // GeoTIFF rounds overview sizes up; the virtual levels round down
+        const int nXSize = std::min(poSrc->GetXSize(), poDst->GetXSize());
+        const int nYSize = std::min(poSrc->GetYSize(), poDst->GetYSize());
+        int nStripHeight = 0, nDummy = 0;
+        poSrc->GetBlockSize(&nDummy, &nStripHeight);
+        std::vector<GByte> abyStrip(static_cast<size_t>(nXSize) * nStripHeight * nDTSize);
+
+        for (int nY = 0; bOK && nY < nYSize; nY += nStripHeight) {
+            if (pbStop && *pbStop) { bOK = false; break; }
+            const int nRows = std::min(nStripHeight, nYSize - nY);
+            bOK = poSrc->RasterIO(GF_Read, 0, nY, nXSize, nRows, abyStrip.data(), nXSize, nRows, eDT, 0, 0) == CE_None &&
+                  poDst->RasterIO(GF_Write, 0, nY, nXSize, nRows, abyStrip.data(), nXSize, nRows, eDT, 0, 0) == CE_None;
+
+            nDonePixels += static_cast<GIntBig>(poSrc->GetXSize()) * nRows;
+            const int nPercent = static_cast<int>(100 * nDonePixels / std::max<GIntBig>(1, nTotalPixels));
+            if (nPercent >= nNextReport) {
+                CPLDebug("NISAR_OVERVIEW", "Overview cache %s: %d%%", osPath.c_str(), nPercent);
+                nNextReport = (nPercent / nProgressStep + 1) * nProgressStep;
+            }
+        }
+    }
+
+    if (bOK) {
+        poDstDS->SetMetadataItem("NISAR_OVR_IDENTITY", osIdentity.c_str());
+        poDstDS->SetMetadataItem("NISAR_OVR_MIN_FACTOR", CPLSPrintf("%d", apoLevels[0]->GetDecimationFactor()));
+        poDstDS->SetMetadataItem("NISAR_OVR_COMPLETE", "YES");
+    }
+    GDALClose(poDstDS);
+    GDALClose(poSrcDS);
+
+    // The rename publishes the finished file in one step
+    if (bOK) bOK = VSIRename(osPartial.c_str(), osPath.c_str()) == 0;
+    if (!bOK) VSIUnlink(osPartial.c_str());
+
+    CPLDebug("NISAR_OVERVIEW", "Overview cache %s %s.", osPath.c_str(), bOK ? "complete" : "abandoned");
+    return bOK;
+}
+
+}  // namespace NisarOverviewCache
@@ -0,0 +1,64 @@
+// nisaroverviewcache.h
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#ifndef NISAR_OVERVIEW_CACHE_H
+#define NISAR_OVERVIEW_CACHE_H
+
+#include <atomic>
+#include <string>
+
+#include "gdal_priv.h"
+
+/***************************************************************************/
+/* Persisted overview cache (NISAR_OVR_CACHE_DIR).                         */
+/* The virtual overview levels of one band, from NISAR_OVR_CACHE_MIN_FACTOR */
+/* down, are written to a tiled DEFLATE GeoTIFF: the finest cached level is */
+/* the main image, the coarser ones its internal overviews. Files are keyed */
+/* by granule identity (path, size, mtime, dataset, band, shape) and the   */
+/* level settings, and carry it as metadata, so a replaced granule or      */
+/* other overview settings never serve stale pixels. Builds write          */
+/* "<sidecar>.<pid>.partial" and rename it once complete.                  */
+/***************************************************************************/
+namespace NisarOverviewCache
+{
+
+// Empty when caching is off
+std::string GetCacheDirectory();
+int GetMinFactor();
+
+// bLevelSettings adds the options that shape the overview levels
+std::string BuildIdentity(const std::string &osRawPath, const std::string &osDatasetDesc, int nBand,
+                          int nXSize, int nYSize, GDALDataType eDT, bool bLevelSettings = true);
+// Stable file key of an identity (FNV-1a)
+GUInt64 HashIdentity(const std::string &osIdentity);
+std::string GetSidecarPath(const std::string &osDir, const std::string &osIdentity);
+
+// Opens a complete sidecar with this identity and nLevels levels; other
+// files are left alone. Returns nullptr if none is usable.
+GDALDataset *OpenSidecar(const std::string &osPath, const std::string &osIdentity, int nLevels);
+
+// True if a live build of this sidecar runs in another process. Partial
+// files older than NISAR_OVR_CACHE_STALE_SECONDS are removed instead.
+bool IsBuildInProgress(const std::string &osPath);
+
+// Process-wide limit on concurrent builds (NISAR_OVR_CACHE_MAX_BUILDS)
+bool TryAcquireBuildSlot();
+void ReleaseBuildSlot();
+
+// Builds the sidecar from a private open of the granule, so the caller's
+// dataset is never touched from the build thread. Polls *pbStop.
+bool BuildSidecar(const std::string &osGranule, CSLConstList papszOpenOptions, int nBand,
+                  const std::string &osPath, const std::string &osIdentity, const std::atomic<bool> *pbStop);
+
+}  // namespace NisarOverviewCache
+
+#endif  // NISAR_OVERVIEW_CACHE_H
@@ -18,6 +18,12 @@
 #include <iomanip>     // for std::setprecision
 #include <chrono>      // for timing instrumentation of H5Dread call
 #include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <limits>
+#include <functional>
+#include <iterator>
 
 #include "hdf5.h"
 #include "gdal.h"        // For CE_Failure, CE_None, GDALDataType
@@ -32,18 +38,16 @@
 #include <arm_neon.h>
 #endif
 
-#ifdef USE_ZLIB_NG
-#include <zlib-ng.h>
-#else
-#include <zlib.h>
-#endif
-
 #include "nisarrasterband.h"
 #include "nisaroverviewband.h"
+#include "nisaroverviewcache.h"
 #include "nisardataset.h"
 #include "nisar_priv.h"
+#include "hdf5vfl.h"
+#include "nisarlocalio.h"
 
 thread_local bool NisarRasterBand::bDisableOverviewRouting = false;
+thread_local bool NisarRasterBand::bDisablePrefetch = false;
 
 /************************************************************************/
 /* ==================================================================== */
@@ -64,7 +68,29 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
         this->eDataType = GDT_Unknown;
         return; 
     }
+    m_iSlice = nBandIn - 1;
+    Initialize(poDSIn, nBandIn, poDSIn->GetBandDatasetHandle(nBandIn));
+}
 
+NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, hid_t hMaskDS, NisarMaskType eMaskType, int iSlice ) :
+      GDALPamRasterBand(),
+      hH5Type(-1),
+      m_hDataset(hMaskDS),
+      m_iSlice(iSlice),
+      m_bIsMask(true),
+      m_eMaskType(eMaskType)
+{
+    Initialize(poDSIn, 0, hMaskDS);
+}
+
+/************************************************************************/
+/*                             Initialize()                             */
+/* Shared by data and mask bands: block geometry, filter pipeline, fill */
+/* value and the chunk index of hDatasetID. Data bands also get their   */
+/* virtual overviews and the Zarr sidecar.                              */
+/************************************************************************/
+void NisarRasterBand::Initialize(NisarDataset *poDSIn, int nBandIn, hid_t hDatasetID)
+{
     this->poDS = poDSIn;
     this->nBand = nBandIn;
 
@@ -73,10 +99,12 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
     this->nRasterYSize = poDSIn->GetRasterYSize();
 
     NisarDataset *poGDS = static_cast<NisarDataset *>(poDSIn);
-    this->eDataType = poGDS->eDataType;
+    m_eStorageType = poGDS->eDataType;
+    m_eDerived = m_bIsMask ? NisarDerived::Kind::None : poGDS->m_eDerived;
+    m_bDerivedFast = poGDS->m_bDerivedFast;
+    this->eDataType = (m_eDerived != NisarDerived::Kind::None) ? GDT_Float32 : m_eStorageType;
 
-    // Get HDF5 Dataset Handle
-    hid_t hDatasetID = poGDS->GetDatasetHandle();
+    m_hDataset = hDatasetID;
     if (hDatasetID < 0)
     {
         CPLError(CE_Warning, CPLE_AppDefined, "NisarRasterBand %d: Parent dataset handle is invalid.", nBandIn);
@@ -89,35 +117,30 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
     {
         CPLError(CE_Warning, CPLE_AppDefined, "NisarRasterBand %d: Failed to get HDF5 native datatype handle.", nBandIn);
     }
+    else if ((nBandIn > 1 || m_bIsMask) && m_eDerived == NisarDerived::Kind::None)
+    {
+        // POL lists may mix real and complex terms; masks are bytes
+        m_eStorageType = NisarDataset::GetGDALDataType(this->hH5Type);
+        this->eDataType = m_eStorageType;
+    }
 
     // Determine Block Size (from HDF5 chunking)
     this->nBlockXSize = 512; // Default
     this->nBlockYSize = 512; // Default
 
+    bool bChunked = false;
     hid_t dcpl_id = H5Dget_create_plist(hDatasetID);
     if (dcpl_id >= 0)
     {
         H5D_layout_t layout = H5Pget_layout(dcpl_id);
         if (layout == H5D_CHUNKED)
         {
-            int nFilters = H5Pget_nfilters(dcpl_id);
-            for (int i = 0; i < nFilters; i++) {
-                unsigned int flags;
-                size_t cd_nelmts = 1;
-                unsigned int cd_values[1] = {0}; // Allocate the buffer for the deflate level
-                char name[128];
-                
-                H5Z_filter_t filter = H5Pget_filter2(dcpl_id, i, &flags, &cd_nelmts, cd_values, sizeof(name), name, nullptr);
-
-                if (filter == H5Z_FILTER_DEFLATE) {
-                    m_bIsDeflated = true;
-                    // HDF5 stores the Zlib compression level in the first index of cd_values
-                    if (cd_nelmts >= 1) {
-                        m_nDeflateLevel = static_cast<int>(cd_values[0]);
-                    }
-                }
-                if (filter == H5Z_FILTER_SHUFFLE) m_bIsShuffled = true;
-            }
+            bChunked = true;
+            m_oFilters.Build(dcpl_id);
+            m_bIsDeflated = m_oFilters.HasDeflate();
+            // HDF5 stores the Zlib compression level in the first index of cd_values
+            m_nDeflateLevel = m_oFilters.GetDeflateLevel();
+            m_bIsShuffled = m_oFilters.HasShuffle();
             hid_t hSpace = H5Dget_space(hDatasetID);
             if (hSpace >= 0) {
                 int rank = H5Sget_simple_extent_ndims(hSpace);
@@ -131,19 +154,42 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
                 H5Sclose(hSpace);
             }
         }
-        else if (layout == H5D_CONTIGUOUS)
+        else if (layout == H5D_CONTIGUOUS || layout == H5D_COMPACT)
         {
+            // Unfiltered single extent: served as full-width strips of
+            // STRIP_HEIGHT rows, or about NISAR_STRIP_BYTES each by default
+            m_bRawLayout = true;
+            const size_t nRowBytes = static_cast<size_t>(nRasterXSize) * GDALGetDataTypeSizeBytes(m_eStorageType);
+            int nStripHeight = poGDS->m_nStripHeight;
+            if (nStripHeight <= 0) {
+                const size_t nStripBytes = static_cast<size_t>(std::max(1LL, atoll(CPLGetConfigOption("NISAR_STRIP_BYTES", "1048576"))));
+                nStripHeight = static_cast<int>(std::min<size_t>(nRasterYSize, std::max<size_t>(1, nStripBytes / std::max<size_t>(1, nRowBytes))));
+            }
             this->nBlockXSize = nRasterXSize;
-            this->nBlockYSize = 1;
+            this->nBlockYSize = std::max(1, std::min(nStripHeight, nRasterYSize));
         }
-        else //H5D_COMPACT or unknown
+        else // Virtual or unknown layout
         {
             this->nBlockXSize = poGDS->GetRasterXSize();
             this->nBlockYSize = 1;
         }
+        InitFillValue(hDatasetID, dcpl_id);
         H5Pclose(dcpl_id);
     }
 
+    // Chunk geometry drives the chunk index and decoding; the GDAL block
+    // may group several chunks (BLOCK_MULTIPLE / BLOCK_SIZE open options).
+    m_nChunkXSize = nBlockXSize;
+    m_nChunkYSize = nBlockYSize;
+    if (bChunked) {
+        poGDS->GetSyntheticBlockSize(m_nChunkXSize, m_nChunkYSize, nRasterXSize, nRasterYSize,
+                                     &nBlockXSize, &nBlockYSize);
+        if (nBlockXSize != m_nChunkXSize || nBlockYSize != m_nChunkYSize) {
+            CPLDebug("NISAR_DRIVER", "Band %d: synthetic %dx%d blocks from %dx%d chunks",
+                     nBandIn, nBlockXSize, nBlockYSize, m_nChunkXSize, m_nChunkYSize);
+        }
+    }
+
     // Create and cache HDF5 dataspace handles
     m_hFileSpaceID = H5Dget_space(hDatasetID);
     
@@ -187,9 +233,11 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
 #else
     m_bNeedsEndianSwap = (fileOrder == H5T_ORDER_LE);
 #endif
-    // 1. Calculate total blocks in the grid
-    int nBlocksPerRow = (nRasterXSize + nBlockXSize - 1) / nBlockXSize;
-    int nBlocksPerCol = (nRasterYSize + nBlockYSize - 1) / nBlockYSize;
+    // 1. Calculate total chunks in the grid
+    int nBlocksPerRow = (nRasterXSize + m_nChunkXSize - 1) / m_nChunkXSize;
+    int nBlocksPerCol = (nRasterYSize + m_nChunkYSize - 1) / m_nChunkYSize;
+    m_nChunksPerRow = nBlocksPerRow;
+    m_nChunksPerCol = nBlocksPerCol;
 
     // Resize the class member vector!
     m_aoAllChunks.resize(nBlocksPerRow * nBlocksPerCol);
@@ -218,23 +266,38 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
                poGDS->GetMetadataItem("valid_max") != nullptr) {
         m_bHasMinMax = true;
     }
+    // Those bounds describe the stored samples, not a derived quantity or the mask
+    if (m_eDerived != NisarDerived::Kind::None || m_bIsMask) m_bHasMinMax = false;
 
     // Read the max allowed virtual decimation from the environment (Default: 16)
     int nMaxVirtualDecimation = atoi(CPLGetConfigOption("NISAR_MAX_VIRTUAL_OVR", "16"));
 
+    // Optional sampled levels: from this factor on, an overview block reads
+    // only DENSITY x DENSITY base blocks, so they are not bound by the cap
+    const int nSampledMinFactor = atoi(CPLGetConfigOption("NISAR_OVR_SAMPLED_MIN_FACTOR", "0"));
+    const int nSampleDensity = std::max(1, atoi(CPLGetConfigOption("NISAR_OVR_SAMPLING_DENSITY", "4")));
+
     // Common power-of-two zoom levels
     int nFactors[] = {2, 4, 8, 16, 32, 64, 128};
 
+    const bool bCascade = CPLTestBool(CPLGetConfigOption("NISAR_OVR_CASCADE", "YES"));
+
     for (int factor : nFactors) {
+        if (m_bIsMask) break; // GDAL derives mask overviews from the data overviews
+        const bool bSampled = nSampledMinFactor > 0 && factor >= nSampledMinFactor && factor > nSampleDensity;
+
         // STOP creating overviews if we hit the computational limit
-        if (factor > nMaxVirtualDecimation) {
+        if (factor > nMaxVirtualDecimation && !bSampled) {
             CPLDebug("NISAR_OVERVIEW", "Capping virtual overviews at decimation %d. Skipping %d.", nMaxVirtualDecimation, factor);
             break;
         }
 
         // Only create an overview if it results in an image at least 1 pixel wide/high
         if (nRasterXSize / factor > 0 && nRasterYSize / factor > 0) {
-            m_apoOverviews.push_back(std::make_unique<NisarOverviewBand>(this, factor));
+            // Each level is reduced from the next finer one (factor 2 from this band)
+            GDALRasterBand* poSource = nullptr;
+            if (bCascade) poSource = m_apoOverviews.empty() ? static_cast<GDALRasterBand*>(this) : m_apoOverviews.back().get();
+            m_apoOverviews.push_back(std::make_unique<NisarOverviewBand>(this, factor, bSampled ? nSampleDensity : 0, poSource));
         }
     }
 
@@ -245,14 +308,14 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
         int nBlockXSize;
         int nBlockYSize;
         int rank;
-        int nBand;
+        int iSlice;
     };
     
-    ChunkIterCtx ctx = { &m_aoAllChunks, nBlocksPerRow, nBlockXSize, nBlockYSize, rank, nBand };
+    ChunkIterCtx ctx = { &m_aoAllChunks, nBlocksPerRow, m_nChunkXSize, m_nChunkYSize, rank, m_iSlice };
 
     // 3. Define the Stateless Lambda Callback
     // Note: Because this lambda captures nothing "[]", it implicitly casts to a C function pointer!
-    H5D_chunk_iter_op_t chunk_cb = [](const hsize_t *offset, unsigned /*filter_mask*/, haddr_t addr, hsize_t size, void *op_data) -> int {
+    H5D_chunk_iter_op_t chunk_cb = [](const hsize_t *offset, unsigned filter_mask, haddr_t addr, hsize_t size, void *op_data) -> int {
         ChunkIterCtx* pCtx = static_cast<ChunkIterCtx*>(op_data);
         
         int nBlockX = 0;
@@ -261,7 +324,7 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
         // Translate HDF5 element offsets back to GDAL Block coordinates
         if (pCtx->rank == 3) {
             // If it's a 3D dataset, ensure we only process chunks belonging to THIS band (Z-index)
-            if (offset[0] != static_cast<hsize_t>(pCtx->nBand - 1)) return 0; // Skip to next chunk
+            if (offset[0] != static_cast<hsize_t>(pCtx->iSlice)) return 0; // Skip to next chunk
             nBlockY = static_cast<int>(offset[1] / pCtx->nBlockYSize);
             nBlockX = static_cast<int>(offset[2] / pCtx->nBlockXSize);
         } else if (pCtx->rank == 2) {
@@ -280,6 +343,7 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
             (*pCtx->paoChunks)[idx].nOffset = static_cast<vsi_l_offset>(addr);
             (*pCtx->paoChunks)[idx].nLength = static_cast<size_t>(size);
             (*pCtx->paoChunks)[idx].bIsMissing = false;
+            (*pCtx->paoChunks)[idx].nFilterMask = filter_mask;
         }
         
         return 0; // Return 0 to tell HDF5 to keep iterating
@@ -287,7 +351,20 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
 
     // 4. Fire the Optimized Iterator
     // This blasts through the B-Tree in native C and populates our vector instantly.
-    H5Dchunk_iter(hDatasetID, H5P_DEFAULT, chunk_cb, &ctx);
+    if (bChunked) {
+        H5Dchunk_iter(hDatasetID, H5P_DEFAULT, chunk_cb, &ctx);
+
+        // Opt-in: look for constant chunks off the open path
+        if (m_oFilters.IsNative() && m_abyFillPixel.size() <= sizeof(NisarChunkInfo::abyConstant) &&
+            CPLTestBool(CPLGetConfigOption("NISAR_DETECT_CONSTANT_CHUNKS", "NO"))) {
+            m_oConstantScan = std::thread(&NisarRasterBand::DetectConstantChunks, this, GetRawVSIPath());
+        }
+    } else if (m_bRawLayout) {
+        BuildRawLayoutIndex(hDatasetID, rank);
+        // Strips are not Zarr chunks (the last one is short): no sidecar
+        return;
+    }
+    if (m_bIsMask) return;
 
     // ====================================================================
     // 5. GENERATE THE SIDECAR (With Remote Target Tracking & Fallbacks)
@@ -336,8 +413,373 @@ NisarRasterBand::NisarRasterBand( NisarDataset *poDSIn, int nBandIn ) :
     WriteVirtualZarrSidecar(osS3Url, osZarrGroup, m_aoAllChunks, osOutJson);
 }
 
+/************************************************************************/
+/*                        DetectConstantChunks()                        */
+/* Background pass over the chunks whose compressed size is a small     */
+/* fraction of their decoded size (NISAR_CONSTANT_CHUNK_RATIO, 64 by    */
+/* default): all-fill borders, water masks, zeroed layers. Each one is  */
+/* decoded once; if every pixel is equal, the chunk is marked constant  */
+/* and later reads replicate that pixel instead of fetching/inflating.  */
+/* Reads go through VSI, never the dataset mapping, which the dataset   */
+/* may release before this band is destroyed.                           */
+/************************************************************************/
+void NisarRasterBand::DetectConstantChunks(std::string sRawPath)
+{
+    const size_t nDTSize = m_abyFillPixel.size();
+    const size_t nChunkBytes = static_cast<size_t>(m_nChunkXSize) * m_nChunkYSize * nDTSize;
+    const size_t nRatio = static_cast<size_t>(std::max(1, atoi(CPLGetConfigOption("NISAR_CONSTANT_CHUNK_RATIO", "64"))));
+
+    std::vector<size_t> anCandidates;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMegaFetchMutex);
+        for (size_t i = 0; i < m_aoAllChunks.size(); i++) {
+            const auto& chunk = m_aoAllChunks[i];
+            if (!chunk.bIsMissing && chunk.nLength > 0 && chunk.nLength * nRatio <= nChunkBytes)
+                anCandidates.push_back(i);
+        }
+    }
+    if (anCandidates.empty()) return;
+
+    VSILFILE* fp = VSIFOpenL(sRawPath.c_str(), "rb");
+    if (!fp) return;
+
+    struct ConstantChunk { size_t nIndex; GByte abyPixel[16]; };
+    std::vector<ConstantChunk> aoFound;
+    std::vector<GByte> abyDecoded(nChunkBytes);
+    constexpr size_t nBatch = 64;
+
+    for (size_t iFirst = 0; iFirst < anCandidates.size() && !m_bStopConstantScan; iFirst += nBatch) {
+        const size_t nCount = std::min(nBatch, anCandidates.size() - iFirst);
+        std::vector<std::vector<GByte>> aabyRaw(nCount);
+        std::vector<void*> apData(nCount);
+        std::vector<vsi_l_offset> anOffsets(nCount);
+        std::vector<size_t> anSizes(nCount);
+        for (size_t k = 0; k < nCount; k++) {
+            const auto& chunk = m_aoAllChunks[anCandidates[iFirst + k]];
+            aabyRaw[k].resize(chunk.nLength);
+            apData[k] = aabyRaw[k].data();
+            anOffsets[k] = chunk.nOffset;
+            anSizes[k] = chunk.nLength;
+        }
+        if (VSIFReadMultiRangeL(static_cast<int>(nCount), apData.data(), anOffsets.data(), anSizes.data(), fp) != 0) break;
+
+        for (size_t k = 0; k < nCount; k++) {
+            const auto& chunk = m_aoAllChunks[anCandidates[iFirst + k]];
+            if (!ProcessAndCopyChunk(aabyRaw[k].data(), aabyRaw[k].size(), chunk.nFilterMask, abyDecoded.data(), false)) continue;
+            // Shifting by one pixel compares every pixel with its successor
+            if (memcmp(abyDecoded.data(), abyDecoded.data() + nDTSize, nChunkBytes - nDTSize) != 0) continue;
+            ConstantChunk oFound;
+            oFound.nIndex = anCandidates[iFirst + k];
+            memcpy(oFound.abyPixel, abyDecoded.data(), nDTSize);
+            aoFound.push_back(oFound);
+        }
+    }
+    VSIFCloseL(fp);
+
+    std::lock_guard<std::mutex> oLock(m_oMegaFetchMutex);
+    for (const auto& oFound : aoFound) {
+        auto& chunk = m_aoAllChunks[oFound.nIndex];
+        memcpy(chunk.abyConstant, oFound.abyPixel, nDTSize);
+        chunk.bIsConstant = true;
+    }
+    CPLDebug("NISAR_DRIVER", "Band %d: %zu of %zu candidate chunks are constant.", nBand, aoFound.size(),
+             anCandidates.size());
+}
+
+/************************************************************************/
+/*                            InitFillValue()                           */
+/* Sparse (never allocated) chunks read as the _FillValue attribute, or */
+/* the DCPL fill value when there is no usable attribute, else zero.    */
+/* Both are read through the native memory type, so complex compound   */
+/* fills come out exactly as HDF5 itself would return them.            */
+/************************************************************************/
+void NisarRasterBand::InitFillValue(hid_t hDatasetID, hid_t hDCPL)
+{
+    const int nDTSize = GDALGetDataTypeSizeBytes(m_eStorageType);
+    m_abyFillPixel.assign(std::max(1, nDTSize), 0);
+    m_bNonZeroFill = false;
+    if (hH5Type < 0 || nDTSize <= 0) return;
+
+    hid_t hMemType = H5Tget_native_type(hH5Type, H5T_DIR_ASCEND);
+    if (hMemType < 0) return;
+    if (H5Tget_size(hMemType) != static_cast<size_t>(nDTSize)) {
+        H5Tclose(hMemType);
+        return;
+    }
+
+    H5E_auto2_t old_func; void *old_client_data;
+    H5Eget_auto2(H5E_DEFAULT, &old_func, &old_client_data);
+    H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+
+    bool bFound = false;
+    if (H5Aexists(hDatasetID, "_FillValue") > 0) {
+        hid_t hAttr = H5Aopen(hDatasetID, "_FillValue", H5P_DEFAULT);
+        if (hAttr >= 0) {
+            bFound = H5Aread(hAttr, hMemType, m_abyFillPixel.data()) >= 0;
+            H5Aclose(hAttr);
+        }
+    }
+    H5D_fill_value_t eFillStatus = H5D_FILL_VALUE_UNDEFINED;
+    if (!bFound && H5Pfill_value_defined(hDCPL, &eFillStatus) >= 0 && eFillStatus == H5D_FILL_VALUE_USER_DEFINED) {
+        bFound = H5Pget_fill_value(hDCPL, hMemType, m_abyFillPixel.data()) >= 0;
+    }
+    if (!bFound) std::fill(m_abyFillPixel.begin(), m_abyFillPixel.end(), 0);
+
+    H5Eset_auto2(H5E_DEFAULT, old_func, old_client_data);
+    H5Tclose(hMemType);
+
+    m_bNonZeroFill = std::any_of(m_abyFillPixel.begin(), m_abyFillPixel.end(), [](GByte b) { return b != 0; });
+}
+
+/************************************************************************/
+/*                            ApplyMaskLUT()                            */
+/* Maps stored mask codes to GDAL mask values (255 valid, 0 invalid) in */
+/* place, on each decoded chunk.                                        */
+/* GCOV: codes 1..5 are valid, i.e. (v - 1) <= 4 unsigned.              */
+/* GUNW: code RS (tens: reference subswath, units: secondary) is valid  */
+/*       when both digits are non-zero; 255 is the fill. The digits are */
+/*       taken in 16-bit lanes with q = (v * 205) >> 11 == v / 10.      */
+/************************************************************************/
+static void ApplyMaskLUT(NisarMaskType eType, GByte* pabyData, size_t nPixels)
+{
+    size_t i = 0;
+    if (eType == NisarMaskType::GCOV) {
+#ifdef __AVX2__
+        const __m256i vOne = _mm256_set1_epi8(1), vFour = _mm256_set1_epi8(4);
+        for (; i + 32 <= nPixels; i += 32) {
+            const __m256i t = _mm256_sub_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pabyData + i)), vOne);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(pabyData + i), _mm256_cmpeq_epi8(_mm256_min_epu8(t, vFour), t));
+        }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        // Both compares return 0xFF or 0x00: their AND is the 255/0 mask
+        const uint8x16_t v_min = vdupq_n_u8(1), v_max = vdupq_n_u8(5);
+        for (; i + 16 <= nPixels; i += 16) {
+            const uint8x16_t pixels = vld1q_u8(pabyData + i);
+            vst1q_u8(pabyData + i, vandq_u8(vcgeq_u8(pixels, v_min), vcleq_u8(pixels, v_max)));
+        }
+#endif
+        for (; i < nPixels; i++) pabyData[i] = (pabyData[i] >= 1 && pabyData[i] <= 5) ? 255 : 0;
+        return;
+    }
+
+#ifdef __AVX2__
+    const __m256i vTen = _mm256_set1_epi16(10), v205 = _mm256_set1_epi16(205);
+    const __m256i vZero = _mm256_setzero_si256(), vFill = _mm256_set1_epi16(255);
+    auto ValidLanes = [&](__m256i v) {
+        const __m256i q = _mm256_srli_epi16(_mm256_mullo_epi16(v, v205), 11);
+        const __m256i units = _mm256_sub_epi16(v, _mm256_mullo_epi16(q, vTen));
+        const __m256i q2 = _mm256_srli_epi16(_mm256_mullo_epi16(q, v205), 11);
+        const __m256i tens = _mm256_sub_epi16(q, _mm256_mullo_epi16(q2, vTen));
+        const __m256i bad = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi16(units, vZero), _mm256_cmpeq_epi16(tens, vZero)),
+                                            _mm256_cmpeq_epi16(v, vFill));
+        return _mm256_andnot_si256(bad, vFill);  // 255 or 0 per 16-bit lane
+    };
+    for (; i + 32 <= nPixels; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pabyData + i));
+        const __m256i lo = ValidLanes(_mm256_unpacklo_epi8(v, vZero));
+        const __m256i hi = ValidLanes(_mm256_unpackhi_epi8(v, vZero));
+        // The unpack and pack pair work within lanes, so they cancel out
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pabyData + i), _mm256_packus_epi16(lo, hi));
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    const uint16x8_t vTen = vdupq_n_u16(10), v205 = vdupq_n_u16(205);
+    auto ValidLanes = [&](uint16x8_t v) {
+        const uint16x8_t q = vshrq_n_u16(vmulq_u16(v, v205), 11);
+        const uint16x8_t units = vmlsq_u16(v, q, vTen);
+        const uint16x8_t tens = vmlsq_u16(q, vshrq_n_u16(vmulq_u16(q, v205), 11), vTen);
+        const uint16x8_t ok = vandq_u16(vandq_u16(vtstq_u16(units, units), vtstq_u16(tens, tens)),
+                                        vmvnq_u16(vceqq_u16(v, vdupq_n_u16(255))));
+        return vmovn_u16(ok);  // 0xFFFF -> 0xFF
+    };
+    for (; i + 16 <= nPixels; i += 16) {
+        const uint8x16_t v = vld1q_u8(pabyData + i);
+        vst1q_u8(pabyData + i, vcombine_u8(ValidLanes(vmovl_u8(vget_low_u8(v))), ValidLanes(vmovl_u8(vget_high_u8(v)))));
+    }
+#endif
+    static const auto gunwLUT = []() {
+        std::vector<GByte> lut(256, 0);
+        for (int v = 1; v < 255; v++) {
+            int nRefSubswath = (v / 10) % 10;
+            int nSecSubswath = v % 10;
+            lut[v] = (nRefSubswath > 0 && nSecSubswath > 0) ? 255 : 0;
+        }
+        return lut;
+    }();
+    for (; i < nPixels; i++) pabyData[i] = gunwLUT[pabyData[i]];
+}
+
+/************************************************************************/
+/*                          BlendMaskedPixels()                         */
+/* APPLY_MASK: overwrites every pixel whose mask value is 0 with        */
+/* pabyMaskedPixel (nPixelBytes of the band type). 4- and 8-byte pixels */
+/* (Float32, CFloat32, Float64, ...) are blended with the mask widened  */
+/* to the pixel lanes; other sizes go pixel by pixel.                   */
+/************************************************************************/
+static void BlendMaskedPixels(GByte* pabyData, int nPixelBytes, const GByte* pabyMask, size_t nPixels,
+                              const GByte* pabyMaskedPixel)
+{
+    size_t i = 0;
+#ifdef __AVX2__
+    if (nPixelBytes == 4) {
+        uint32_t nValue;
+        memcpy(&nValue, pabyMaskedPixel, 4);
+        const __m256i vValue = _mm256_set1_epi32(static_cast<int>(nValue)), vZero = _mm256_setzero_si256();
+        for (; i + 8 <= nPixels; i += 8) {
+            const __m256i vInvalid = _mm256_cmpeq_epi32(
+                _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pabyMask + i))), vZero);
+            __m256i* pDst = reinterpret_cast<__m256i*>(pabyData + i * 4);
+            _mm256_storeu_si256(pDst, _mm256_blendv_epi8(_mm256_loadu_si256(pDst), vValue, vInvalid));
+        }
+    } else if (nPixelBytes == 8) {
+        int64_t nValue;
+        memcpy(&nValue, pabyMaskedPixel, 8);
+        const __m256i vValue = _mm256_set1_epi64x(nValue), vZero = _mm256_setzero_si256();
+        for (; i + 4 <= nPixels; i += 4) {
+            int32_t nMask4;
+            memcpy(&nMask4, pabyMask + i, 4);
+            const __m256i vInvalid = _mm256_cmpeq_epi64(_mm256_cvtepu8_epi64(_mm_cvtsi32_si128(nMask4)), vZero);
+            __m256i* pDst = reinterpret_cast<__m256i*>(pabyData + i * 8);
+            _mm256_storeu_si256(pDst, _mm256_blendv_epi8(_mm256_loadu_si256(pDst), vValue, vInvalid));
+        }
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (nPixelBytes == 4 || nPixelBytes == 8) {
+        uint32_t nValue32 = 0;
+        uint64_t nValue64 = 0;
+        if (nPixelBytes == 4) memcpy(&nValue32, pabyMaskedPixel, 4);
+        else memcpy(&nValue64, pabyMaskedPixel, 8);
+        const uint32x4_t vValue32 = vdupq_n_u32(nValue32);
+        const uint64x2_t vValue64 = vdupq_n_u64(nValue64);
+        for (; i + 8 <= nPixels; i += 8) {
+            // 0xFFFFFFFF in the lanes of invalid pixels
+            const uint16x8_t vMask16 = vmovl_u8(vld1_u8(pabyMask + i));
+            const uint32x4_t aInvalid[2] = {vceqzq_u32(vmovl_u16(vget_low_u16(vMask16))),
+                                            vceqzq_u32(vmovl_u16(vget_high_u16(vMask16)))};
+            for (int h = 0; h < 2; h++) {
+                if (nPixelBytes == 4) {
+                    uint32_t* pDst = reinterpret_cast<uint32_t*>(pabyData) + i + h * 4;
+                    vst1q_u32(pDst, vbslq_u32(aInvalid[h], vValue32, vld1q_u32(pDst)));
+                } else {
+                    uint64_t* pDst = reinterpret_cast<uint64_t*>(pabyData) + i + h * 4;
+                    const uint64x2_t vLo = vreinterpretq_u64_s64(vmovl_s32(vreinterpret_s32_u32(vget_low_u32(aInvalid[h]))));
+                    const uint64x2_t vHi = vreinterpretq_u64_s64(vmovl_s32(vreinterpret_s32_u32(vget_high_u32(aInvalid[h]))));
+                    vst1q_u64(pDst, vbslq_u64(vLo, vValue64, vld1q_u64(pDst)));
+                    vst1q_u64(pDst + 2, vbslq_u64(vHi, vValue64, vld1q_u64(pDst + 2)));
+                }
+            }
+        }
+    }
+#endif
+    for (; i < nPixels; i++) {
+        if (pabyMask[i] == 0) memcpy(pabyData + i * nPixelBytes, pabyMaskedPixel, nPixelBytes);
+    }
+}
+
+void NisarRasterBand::FillPixels(GByte* pabyDst, size_t nPixels, const GByte* pabyPixel) const
+{
+    if (m_bIsMask) {
+        // Mask code of the fill / constant pixel, mapped once
+        GByte byValue = pabyPixel ? pabyPixel[0] : m_abyFillPixel[0];
+        ApplyMaskLUT(m_eMaskType, &byValue, 1);
+        memset(pabyDst, byValue, nPixels);
+        return;
+    }
+    if (m_eDerived != NisarDerived::Kind::None) {
+        // Derive the one pixel, then replicate it (0+0j is -inf in DB)
+        float fValue = 0.0f;
+        NisarDerived::Apply(m_eDerived, m_bDerivedFast, pabyPixel ? pabyPixel : m_abyFillPixel.data(),
+                            m_eStorageType, 1, &fValue);
+        GDALCopyWords64(&fValue, GDT_Float32, 0, pabyDst, GDT_Float32, sizeof(float), static_cast<GPtrDiff_t>(nPixels));
+        return;
+    }
+    if (!pabyPixel && !m_bNonZeroFill) {
+        memset(pabyDst, 0, nPixels * m_abyFillPixel.size());
+        return;
+    }
+    // Source stride 0 replicates the single pixel (GDALReplicateWord)
+    const int nDTSize = static_cast<int>(m_abyFillPixel.size());
+    GDALCopyWords64(pabyPixel ? pabyPixel : m_abyFillPixel.data(), eDataType, 0, pabyDst, eDataType, nDTSize,
+                    static_cast<GPtrDiff_t>(nPixels));
+}
+
+void NisarRasterBand::FillChunkInBlock(int nChunkX, int nChunkY, const GByte* pabyPixel, GByte* pabyBlock) const
+{
+    if (m_nChunkXSize == nBlockXSize && m_nChunkYSize == nBlockYSize) {
+        FillPixels(pabyBlock, static_cast<size_t>(nBlockXSize) * nBlockYSize, pabyPixel);
+        return;
+    }
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const size_t nBlockRowBytes = static_cast<size_t>(nBlockXSize) * nDTSize;
+    GByte* pabyDst = pabyBlock
+                   + static_cast<size_t>(nChunkY % (nBlockYSize / m_nChunkYSize)) * m_nChunkYSize * nBlockRowBytes
+                   + static_cast<size_t>(nChunkX % (nBlockXSize / m_nChunkXSize)) * m_nChunkXSize * nDTSize;
+    for (int iRow = 0; iRow < m_nChunkYSize; iRow++)
+        FillPixels(pabyDst + iRow * nBlockRowBytes, m_nChunkXSize, pabyPixel);
+}
+
+/************************************************************************/
+/*                         BuildRawLayoutIndex()                        */
+/* Contiguous layers: H5Dget_offset() gives the storage address and     */
+/* each strip is a computed byte range into it. Compact layers are read */
+/* once into memory and indexed the same way, relative to that buffer.  */
+/* Unallocated storage stays missing and reads as the fill value.       */
+/************************************************************************/
+void NisarRasterBand::BuildRawLayoutIndex(hid_t hDatasetID, int rank)
+{
+    const size_t nRowBytes = static_cast<size_t>(nRasterXSize) * GDALGetDataTypeSizeBytes(m_eStorageType);
+    const vsi_l_offset nPlaneOffset = (rank == 3) ? static_cast<vsi_l_offset>(m_iSlice) * nRasterYSize * nRowBytes : 0;
+
+    vsi_l_offset nBase = 0;
+    hid_t dcpl_id = H5Dget_create_plist(hDatasetID);
+    const H5D_layout_t layout = (dcpl_id >= 0) ? H5Pget_layout(dcpl_id) : H5D_LAYOUT_ERROR;
+    if (dcpl_id >= 0) H5Pclose(dcpl_id);
+
+    if (layout == H5D_COMPACT) {
+        // Compact data lives in the object header (64 KiB at most)
+        hsize_t nStorage = H5Dget_storage_size(hDatasetID);
+        m_abyCompactData.resize(static_cast<size_t>(nStorage));
+        if (nStorage == 0 ||
+            H5Dread(hDatasetID, hH5Type, H5S_ALL, H5S_ALL, H5P_DEFAULT, m_abyCompactData.data()) < 0) {
+            CPLDebug("NISAR_DRIVER", "Band %d: compact layout could not be read; returning the fill value.", nBand);
+            m_abyCompactData.clear();
+            return;
+        }
+    } else {
+        const haddr_t nAddr = H5Dget_offset(hDatasetID);
+        if (nAddr == HADDR_UNDEF) {
+            CPLDebug("NISAR_DRIVER", "Band %d: contiguous storage not allocated (or external); returning the fill value.", nBand);
+            return;
+        }
+        nBase = static_cast<vsi_l_offset>(nAddr);
+    }
+
+    for (int iStrip = 0; iStrip < m_nChunksPerCol; iStrip++) {
+        auto& strip = m_aoAllChunks[iStrip];
+        const int nRows = std::min(m_nChunkYSize, nRasterYSize - iStrip * m_nChunkYSize);
+        strip.nOffset = nBase + nPlaneOffset + static_cast<vsi_l_offset>(iStrip) * m_nChunkYSize * nRowBytes;
+        strip.nLength = static_cast<size_t>(nRows) * nRowBytes;
+        strip.bIsMissing = (layout == H5D_COMPACT) && strip.nOffset + strip.nLength > m_abyCompactData.size();
+    }
+    CPLDebug("NISAR_DRIVER", "Band %d: %s layout served as %d strips of %d rows.", nBand,
+             layout == H5D_COMPACT ? "compact" : "contiguous", m_nChunksPerCol, m_nChunkYSize);
+}
+
 NisarRasterBand::~NisarRasterBand()
 {
+    // Abandoned hedged requests drain before VSI can be torn down
+    JoinFetchThreads(true);
+
+    if (m_oOvrCacheBuild.joinable()) {
+        m_bStopOvrCacheBuild = true;
+        m_oOvrCacheBuild.join();
+    }
+    if (m_poOvrCacheDS) GDALClose(m_poOvrCacheDS);
+
+    if (m_oConstantScan.joinable()) {
+        m_bStopConstantScan = true;
+        m_oConstantScan.join();
+    }
+
     // Close the cached HDF5 objects
     if (m_hMemSpaceID >= 0) H5Sclose(m_hMemSpaceID);
     if (m_hFileSpaceID >= 0) H5Sclose(m_hFileSpaceID);
@@ -347,9 +789,8 @@ NisarRasterBand::~NisarRasterBand()
              CPLError(CE_Warning, CPLE_AppDefined, "Failed to close HDF5 data type handle in ~NisarRasterBand.");
         }
     }
-    if (m_bMaskBandOwned && m_poMaskBand) {
-        delete m_poMaskBand;
-    }
+    // Mask bands own the sibling dataset they were opened on
+    if (m_bIsMask && m_hDataset >= 0) H5Dclose(m_hDataset);
 }
 
 std::string NisarRasterBand::GetRawVSIPath() const
@@ -445,68 +886,57 @@ std::string NisarRasterBand::GetStandardDatasetURI() const
     return sDesc; 
 }
 
-bool NisarRasterBand::ProcessAndCopyChunk(const GByte* pSrcData, size_t nSrcSize, void* pDstData)
+bool NisarRasterBand::ProcessAndCopyChunk(const GByte* pSrcData, size_t nSrcSize, unsigned int nFilterMask,
+                                          void* pDstData, bool bDerive)
 {
-    size_t nElements = static_cast<size_t>(nBlockXSize) * nBlockYSize;
-    int nElementSize = GDALGetDataTypeSizeBytes(eDataType);
+    size_t nElements = static_cast<size_t>(m_nChunkXSize) * m_nChunkYSize;
+    int nElementSize = GDALGetDataTypeSizeBytes(m_eStorageType);
     size_t nUncompressedSize = nElements * nElementSize;
 
-    const GByte* pWorkingData = pSrcData;
-
     // Use a thread_local buffer. This allocates memory ONCE per thread,
     // and reuses it for every chunk without zero-initializing it!
     thread_local std::vector<GByte> tls_uncompressedData;
 
-    if (m_bIsDeflated) {
-        // resize() will not zero-initialize bytes if the capacity is already large enough
-        if (tls_uncompressedData.size() < nUncompressedSize) {
-            tls_uncompressedData.resize(nUncompressedSize);
-        }
-
-        // -------------------------------------------------------------
-        // DECOMPRESSION ROUTING
-        // -------------------------------------------------------------
-        int zErr;
-#ifdef USE_ZLIB_NG
-        // The hardware-accelerated SIMD path
-        z_size_t destLen = static_cast<z_size_t>(nUncompressedSize);
-        zErr = zng_uncompress(
-            tls_uncompressedData.data(),
-            &destLen,
-            pSrcData,
-            static_cast<z_size_t>(nSrcSize)
-        );
-#else
-        // The standard legacy zlib fallback path
-        uLongf destLen = static_cast<uLongf>(nUncompressedSize);
-        zErr = uncompress(
-            tls_uncompressedData.data(),
-            &destLen,
-            pSrcData,
-            static_cast<uLong>(nSrcSize)
-        );
-#endif
-
-        if (zErr != Z_OK) return false;
+    // DERIVED: the stored samples land in a per-thread staging chunk and
+    // only the Float32 transform is written to pDstData
+    thread_local std::vector<GByte> tls_storedChunk;
+    void* pFinalDst = pDstData;
+    const bool bApplyDerived = bDerive && m_eDerived != NisarDerived::Kind::None;
+    if (bApplyDerived) {
+        if (tls_storedChunk.size() < nUncompressedSize) tls_storedChunk.resize(nUncompressedSize);
+        pDstData = tls_storedChunk.data();
+    }
 
-        pWorkingData = tls_uncompressedData.data();
+    // -------------------------------------------------------------
+    // FILTER PIPELINE (checksum, DEFLATE / ZSTD; SHUFFLE is fused below)
+    // -------------------------------------------------------------
+    const GByte* pWorkingData = pSrcData;
+    size_t nWorkingSize = nSrcSize;
+    bool bUnshuffle = false;
+    if (!m_oFilters.Decode(pSrcData, nSrcSize, nFilterMask, nUncompressedSize, tls_uncompressedData,
+                           &pWorkingData, &nWorkingSize, &bUnshuffle)) {
+        return false;
     }
+    if (bUnshuffle && nWorkingSize != nUncompressedSize) return false;
+
+    // Per-call copy: the shuffle kernel folds the swap into its plane order
+    bool bNeedsEndianSwap = m_bNeedsEndianSwap;
 
     // -------------------------------------------------------------
     // Fused Un-Shuffle & Endianness Filter
     // -------------------------------------------------------------
-    if (m_bIsShuffled && nElementSize > 1) {
+    if (bUnshuffle && nElementSize > 1) {
         GByte* dst = static_cast<GByte*>(pDstData);
 
         // Invert plane reading order to get a "free" endian swap
         int p0 = 0, p1 = 1, p2 = 2, p3 = 3, p4 = 4, p5 = 5, p6 = 6, p7 = 7;
-        if (m_bNeedsEndianSwap) {
+        if (bNeedsEndianSwap) {
             if (nElementSize == 2) { p0 = 1; p1 = 0; }
             else if (nElementSize == 4) { p0 = 3; p1 = 2; p2 = 1; p3 = 0; }
             else if (nElementSize == 8) { p0 = 7; p1 = 6; p2 = 5; p3 = 4; p4 = 3; p5 = 2; p6 = 1; p7 = 0; }
             
             // Flag as complete so the fallback GDALSwapWords block doesn't run
-            m_bNeedsEndianSwap = false; 
+            bNeedsEndianSwap = false;
         }
 
         if (nElementSize == 4) { // Float32 / Int32
@@ -649,6 +1079,11 @@ bool NisarRasterBand::ProcessAndCopyChunk(const GByte* pSrcData, size_t nSrcSize
             }
         }
     } 
+    else if (nWorkingSize < nUncompressedSize) {
+        // Short raw strip (last strip of a contiguous layer): zero the tail
+        memcpy(pDstData, pWorkingData, nWorkingSize);
+        memset(static_cast<GByte*>(pDstData) + nWorkingSize, 0, nUncompressedSize - nWorkingSize);
+    }
     else {
         // Direct copy for 1-byte data types (QA Masks) or non-shuffled data
         memcpy(pDstData, pWorkingData, nUncompressedSize);
@@ -657,7 +1092,7 @@ bool NisarRasterBand::ProcessAndCopyChunk(const GByte* pSrcData, size_t nSrcSize
     // -------------------------------------------------------------
     // Endianness Correction (Fallback for non-shuffled data)
     // -------------------------------------------------------------
-    if (m_bNeedsEndianSwap && nElementSize > 1) {
+    if (bNeedsEndianSwap && nElementSize > 1) {
 #if defined(__aarch64__) || defined(_M_ARM64)
         if (nElementSize == 4) {
             uint32_t* ptr = static_cast<uint32_t*>(pDstData);
@@ -682,6 +1117,48 @@ bool NisarRasterBand::ProcessAndCopyChunk(const GByte* pSrcData, size_t nSrcSize
 #endif
     }
 
+    if (bApplyDerived) {
+        NisarDerived::Apply(m_eDerived, m_bDerivedFast, pDstData, m_eStorageType, nElements,
+                            static_cast<float*>(pFinalDst));
+    }
+    if (bDerive && m_bIsMask) ApplyMaskLUT(m_eMaskType, static_cast<GByte*>(pDstData), nElements);
+    return true;
+}
+
+/************************************************************************/
+/*                        DecodeChunkIntoBlock()                        */
+/* Decodes one HDF5 chunk into its sub-rectangle of a (possibly         */
+/* synthetic) GDAL block. A null source fills that sub-rectangle with   */
+/* the fill value.                                                      */
+/************************************************************************/
+bool NisarRasterBand::DecodeChunkIntoBlock(const GByte* pSrcData, size_t nSrcSize, unsigned int nFilterMask,
+                                           int nChunkX, int nChunkY, GByte* pabyBlock)
+{
+    const bool bWholeBlock = (m_nChunkXSize == nBlockXSize && m_nChunkYSize == nBlockYSize);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const size_t nChunkRowBytes = static_cast<size_t>(m_nChunkXSize) * nDTSize;
+    const size_t nBlockRowBytes = static_cast<size_t>(nBlockXSize) * nDTSize;
+
+    if (!pSrcData) {
+        FillChunkInBlock(nChunkX, nChunkY, nullptr, pabyBlock);
+        return true;
+    }
+    if (bWholeBlock) return ProcessAndCopyChunk(pSrcData, nSrcSize, nFilterMask, pabyBlock);
+
+    const int nMultX = nBlockXSize / m_nChunkXSize;
+    const int nMultY = nBlockYSize / m_nChunkYSize;
+    GByte* pabyDst = pabyBlock
+                   + static_cast<size_t>(nChunkY % nMultY) * m_nChunkYSize * nBlockRowBytes
+                   + static_cast<size_t>(nChunkX % nMultX) * nChunkRowBytes;
+
+    thread_local std::vector<GByte> tls_chunkScratch;
+    if (tls_chunkScratch.size() < nChunkRowBytes * m_nChunkYSize)
+        tls_chunkScratch.resize(nChunkRowBytes * m_nChunkYSize);
+
+    if (!ProcessAndCopyChunk(pSrcData, nSrcSize, nFilterMask, tls_chunkScratch.data())) return false;
+
+    for (int iRow = 0; iRow < m_nChunkYSize; iRow++)
+        memcpy(pabyDst + iRow * nBlockRowBytes, tls_chunkScratch.data() + iRow * nChunkRowBytes, nChunkRowBytes);
     return true;
 }
 
@@ -700,18 +1177,96 @@ GDALRasterBand* NisarRasterBand::GetOverview(int i)
     if (i < 0 || i >= static_cast<int>(m_apoOverviews.size())) {
         return nullptr;
     }
+    UpdateOverviewCache();
     // The compiler now knows this safely casts to GDALRasterBand*
     return m_apoOverviews[i].get();
 }
 
+/***************************************************************************/
+/*                          UpdateOverviewCache()                          */
+/* First call: serve the levels from a matching sidecar, or start building */
+/* one in the background. Later calls pick the sidecar up once the build   */
+/* has finished. Runs on the thread that owns this dataset.                */
+/***************************************************************************/
+void NisarRasterBand::UpdateOverviewCache()
+{
+    if (m_poOvrCacheDS) return;
+
+    if (!m_bOvrCacheChecked) {
+        m_bOvrCacheChecked = true;
+        const std::string osDir = NisarOverviewCache::GetCacheDirectory();
+        if (osDir.empty()) return;
+        const int nMinFactor = NisarOverviewCache::GetMinFactor();
+        if (m_apoOverviews.empty() || m_apoOverviews.back()->GetDecimationFactor() < nMinFactor) return;
+
+        // POL-selected layers share the granule name: key on the band's HDF5 path,
+        // and DERIVED bands of one layer share the Float32 type: key on the transform
+        // (and on APPLY_MASK, which changes the pixels)
+        std::string osDatasetDesc = std::string(poDS->GetDescription()) + "|" +
+            get_hdf5_object_name(m_hDataset);
+        if (m_eDerived != NisarDerived::Kind::None)
+            osDatasetDesc += CPLSPrintf("|DERIVED=%s,%s", NisarDerived::GetName(m_eDerived), m_bDerivedFast ? "FAST" : "EXACT");
+        if (m_bApplyMask) osDatasetDesc += "|APPLY_MASK";
+        m_osOvrCacheIdentity = NisarOverviewCache::BuildIdentity(GetRawVSIPath(), osDatasetDesc, nBand,
+                                                                 nRasterXSize, nRasterYSize, eDataType);
+        m_osOvrCachePath = NisarOverviewCache::GetSidecarPath(osDir, m_osOvrCacheIdentity);
+        if (AttachOverviewCache()) return;
+
+        if (NisarOverviewCache::IsBuildInProgress(m_osOvrCachePath) || !NisarOverviewCache::TryAcquireBuildSlot()) {
+            CPLDebug("NISAR_OVERVIEW", "Overview cache %s: build skipped (in progress elsewhere or at NISAR_OVR_CACHE_MAX_BUILDS).",
+                     m_osOvrCachePath.c_str());
+            return;
+        }
+        VSIMkdirRecursive(osDir.c_str(), 0755);
+        m_oOvrCacheBuild = std::thread([this, osGranule = std::string(poDS->GetDescription()),
+                                        aosOpenOptions = CPLStringList(CSLDuplicate(poDS->GetOpenOptions())),
+                                        nBandIdx = nBand, osPath = m_osOvrCachePath, osIdentity = m_osOvrCacheIdentity]() mutable {
+            m_bOvrCacheBuilt = NisarOverviewCache::BuildSidecar(osGranule, aosOpenOptions.List(), nBandIdx, osPath, osIdentity,
+                                                                &m_bStopOvrCacheBuild);
+            NisarOverviewCache::ReleaseBuildSlot();
+        });
+        return;
+    }
+
+    if (m_bOvrCacheBuilt && m_oOvrCacheBuild.joinable()) {
+        m_oOvrCacheBuild.join();
+        AttachOverviewCache();
+    }
+}
+
+bool NisarRasterBand::AttachOverviewCache()
+{
+    size_t iFirst = 0;
+    while (iFirst < m_apoOverviews.size() &&
+           m_apoOverviews[iFirst]->GetDecimationFactor() < NisarOverviewCache::GetMinFactor()) iFirst++;
+    const int nLevels = static_cast<int>(m_apoOverviews.size() - iFirst);
+
+    m_poOvrCacheDS = NisarOverviewCache::OpenSidecar(m_osOvrCachePath, m_osOvrCacheIdentity, nLevels);
+    if (!m_poOvrCacheDS) return false;
+
+    GDALRasterBand* poCacheBand = m_poOvrCacheDS->GetRasterBand(1);
+    for (size_t i = iFirst; i < m_apoOverviews.size(); i++) {
+        m_apoOverviews[i]->SetCacheBand(i == iFirst ? poCacheBand : poCacheBand->GetOverview(static_cast<int>(i - iFirst) - 1));
+    }
+    CPLDebug("NISAR_OVERVIEW", "Serving %d overview levels from %s.", nLevels, m_osOvrCachePath.c_str());
+    return true;
+}
+
 int NisarRasterBand::GetMaskFlags()
 {
+    // A mask band is itself all valid
+    if (m_bIsMask) return GMF_ALL_VALID;
+
+    // APPLY_MASK: invalid pixels already read as the nodata value
+    if (m_bApplyMask) return GDALPamRasterBand::GetMaskFlags();
+
     // Trigger discovery via GetMaskBand() to see if we populate m_poMaskBand
     GetMaskBand();
 
-    // If we successfully created a custom NISAR mask band, declare it as shared.
+    // A 2D mask is shared by every band; a per-band slice of a 3D mask is not
     if (m_poMaskBand) {
-        return GMF_PER_DATASET;
+        NisarDataset* poNisarDS = static_cast<NisarDataset*>(poDS);
+        return poNisarDS->m_apoLayerMasks.size() == 1 ? GMF_PER_DATASET : 0;
     }
 
     // Otherwise, per GDAL RFC 15, we declare that all pixels are valid.
@@ -720,22 +1275,40 @@ int NisarRasterBand::GetMaskFlags()
 
 GDALRasterBand* NisarRasterBand::GetMaskBand()
 {
-    // Return cached if exists
-    if (m_poMaskBand) return m_poMaskBand;
+    // Mask bands, APPLY_MASK and -oo MASK=NO (the default) use the GDAL mask
+    NisarDataset* poNisarDS = static_cast<NisarDataset*>(poDS);
+    if (m_bIsMask || m_bApplyMask || !poNisarDS || !poNisarDS->m_bMaskEnabled) {
+        return GDALPamRasterBand::GetMaskBand();
+    }
 
-    //  Cast the dataset
-    NisarDataset* poNisarDS = (NisarDataset*)poDS;
-    if (!poNisarDS) return GDALPamRasterBand::GetMaskBand();
+    GDALRasterBand* poMaskBand = FindLayerMask();
+    return poMaskBand ? poMaskBand : GDALPamRasterBand::GetMaskBand();
+}
 
-    // If user explicitly disabled masks via -oo MASK=NO, return "All Valid"
-    if (!poNisarDS->m_bMaskEnabled) {
-        return GDALPamRasterBand::GetMaskBand(); 
+/************************************************************************/
+/*                            FindLayerMask()                           */
+/* Opens the sibling "mask" dataset of this layer as a mask-mode band,  */
+/* once per dataset. nullptr when the layer has no usable mask.         */
+/************************************************************************/
+NisarRasterBand* NisarRasterBand::FindLayerMask()
+{
+    // Return cached if exists
+    if (m_poMaskBand || m_bIsMask) return m_poMaskBand;
+    NisarDataset* poNisarDS = static_cast<NisarDataset*>(poDS);
+
+    // Opened once per dataset: every band (or its slice) shares it
+    if (!poNisarDS->m_apoLayerMasks.empty()) {
+        const size_t iMask = poNisarDS->m_apoLayerMasks.size() == 1 ? 0 : static_cast<size_t>(nBand - 1);
+        if (iMask < poNisarDS->m_apoLayerMasks.size() && poNisarDS->m_apoLayerMasks[iMask]) {
+            m_poMaskBand = poNisarDS->m_apoLayerMasks[iMask];
+            return m_poMaskBand;
+        }
     }
 
     // Construct Mask Path
     // Instead of relying on metadata, we ask HDF5 for the true path of the current dataset.
     // get_hdf5_object_name is defined in nisar_priv.h
-    std::string sBandPath = get_hdf5_object_name(poNisarDS->GetDatasetHandle());
+    std::string sBandPath = get_hdf5_object_name(m_hDataset);
     
     if (sBandPath.empty()) {
         // Fallback: If HDF5 name query fails, try metadata (though unlikely to be needed)
@@ -743,11 +1316,11 @@ GDALRasterBand* NisarRasterBand::GetMaskBand()
         if (pszPath) sBandPath = pszPath;
     }
 
-    if (sBandPath.empty()) return GDALPamRasterBand::GetMaskBand();
+    if (sBandPath.empty()) return nullptr;
 
     // Find the parent group (e.g., remove "/HHHH" from ".../frequencyA/HHHH")
     size_t nLastSlash = sBandPath.find_last_of('/');
-    if (nLastSlash == std::string::npos) return GDALPamRasterBand::GetMaskBand();
+    if (nLastSlash == std::string::npos) return nullptr;
 
     // Construct sibling path: ".../frequencyA/mask"
     std::string sMaskPath = sBandPath.substr(0, nLastSlash) + "/mask";
@@ -762,8 +1335,35 @@ GDALRasterBand* NisarRasterBand::GetMaskBand()
     H5Eset_auto2(H5E_DEFAULT, old_func, old_client_data);
 
     if (hMaskDS < 0) {
-        return GDALPamRasterBand::GetMaskBand(); // No mask found
+        return nullptr; // No mask found
+    }
+
+    // Byte mask on the raster grid: 2D, or 3D with one slice per band
+    int nSlices = 0;
+    {
+        hid_t hSpace = H5Dget_space(hMaskDS);
+        const int nRank = hSpace >= 0 ? H5Sget_simple_extent_ndims(hSpace) : -1;
+        if (nRank == 2 || nRank == 3) {
+            hsize_t anDims[3] = {0, 0, 0};
+            H5Sget_simple_extent_dims(hSpace, anDims, nullptr);
+            if (anDims[nRank - 1] == static_cast<hsize_t>(nRasterXSize) &&
+                anDims[nRank - 2] == static_cast<hsize_t>(nRasterYSize)) {
+                nSlices = (nRank == 3) ? static_cast<int>(anDims[0]) : 1;
+            }
+        }
+        if (hSpace >= 0) H5Sclose(hSpace);
+
+        hid_t hType = H5Dget_type(hMaskDS);
+        if (hType < 0 || NisarDataset::GetGDALDataType(hType) != GDT_Byte) nSlices = 0;
+        if (hType >= 0) H5Tclose(hType);
+    }
+    if (nSlices < 1) {
+        CPLDebug("NISAR_DRIVER", "Ignoring %s: not a byte mask on the %dx%d raster grid.",
+                 sMaskPath.c_str(), nRasterXSize, nRasterYSize);
+        H5Dclose(hMaskDS);
+        return nullptr;
     }
+    const bool bPerBand = (nSlices > 1 && nSlices == poNisarDS->GetRasterCount());
 
     // Determine Mask Logic Type
     NisarMaskType eMaskType = NisarMaskType::GCOV; // Default
@@ -774,114 +1374,969 @@ GDALRasterBand* NisarRasterBand::GetMaskBand()
         eMaskType = NisarMaskType::GUNW;
     }
 
-    // Instantiate the correct class
-    m_poMaskBand = new NisarHDF5MaskBand(poNisarDS, hMaskDS, eMaskType);
-    m_bMaskBandOwned = true;
+    // Decoded by the chunk engine like any band; the handle is reopened
+    // per slice so that each mask band owns its own
+    poNisarDS->m_apoLayerMasks.assign(bPerBand ? nSlices : 1, nullptr);
+    if (bPerBand) {
+        for (int i = 0; i < nSlices; i++) {
+            hid_t hSliceDS = (i == nBand - 1) ? hMaskDS : H5Dopen2(poNisarDS->GetHDF5Handle(), sMaskPath.c_str(), H5P_DEFAULT);
+            if (hSliceDS >= 0) poNisarDS->m_apoLayerMasks[i] = new NisarRasterBand(poNisarDS, hSliceDS, eMaskType, i);
+        }
+    } else {
+        poNisarDS->m_apoLayerMasks[0] = new NisarRasterBand(poNisarDS, hMaskDS, eMaskType, 0);
+    }
 
+    m_poMaskBand = poNisarDS->m_apoLayerMasks[bPerBand ? nBand - 1 : 0];
     return m_poMaskBand;
 }
 
-/***************************************************************************/
-/*                             IReadBlock()                                */
-/* This method reads a block of data from the HDF5 dataset.                */
-/***************************************************************************/
-CPLErr NisarRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
+/************************************************************************/
+/*                           EnableApplyMask()                          */
+/* APPLY_MASK=YES: pixels the layer mask marks invalid read as the      */
+/* nodata value, or NaN on floating-point bands without one. Integer    */
+/* bands without a nodata value have nothing to write and stay as is.   */
+/************************************************************************/
+bool NisarRasterBand::EnableApplyMask()
 {
-    // We lock to ensure the network arrays build cleanly, but we will 
-    // manually drop this lock before we touch the GDAL Block Cache.
-    std::unique_lock<std::mutex> oLock(m_oMegaFetchMutex);
-
-    // -------------------------------------------------------------
-    // ALIGNED PREFETCH EXPANSION (Mega-Fetch)
-    // -------------------------------------------------------------
-
-    // Default to 1 (No prefetching) for dynamic TiTiler web serving and windowed reads.
-    // Can be overridden to 24 via environment variable for full-frame AWS Batch jobs.
+    if (m_bIsMask || FindLayerMask() == nullptr) return false;
+
+    int bHasNoData = FALSE;
+    double dfMaskedValue = GetNoDataValue(&bHasNoData);
+    if (!bHasNoData) {
+        if (!GDALDataTypeIsFloating(eDataType)) {
+            CPLDebug("NISAR_DRIVER", "Band %d: APPLY_MASK ignored on a %s band without nodata.",
+                     nBand, GDALGetDataTypeName(eDataType));
+            return false;
+        }
+        dfMaskedValue = std::numeric_limits<double>::quiet_NaN();
+        SetNoDataValue(dfMaskedValue);
+    }
 
-    int nPrefetchGrid = atoi(CPLGetConfigOption("NISAR_PREFETCH_GRID", "1"));
-    if (nPrefetchGrid < 1) nPrefetchGrid = 1;
+    // Complex bands get the value in both parts
+    const double adfValue[2] = {dfMaskedValue, dfMaskedValue};
+    m_abyMaskedPixel.resize(GDALGetDataTypeSizeBytes(eDataType));
+    GDALCopyWords(adfValue, GDT_CFloat64, 0, m_abyMaskedPixel.data(), eDataType, 0, 1);
+    m_bApplyMask = true;
+    return true;
+}
 
-    int nTotalBlocksX = (nRasterXSize + nBlockXSize - 1) / nBlockXSize;
-    int nTotalBlocksY = (nRasterYSize + nBlockYSize - 1) / nBlockYSize;
+/************************************************************************/
+/*                        EnsureCoverageSummary()                       */
+/* Mask bands, NISAR_MASK_SUMMARY=YES: classifies every mask chunk as   */
+/* all invalid, all valid or mixed, once. Uniform chunks then become    */
+/* constant chunks of the mask, and data bands under APPLY_MASK skip    */
+/* the fetch of chunks that would be masked out entirely.               */
+/************************************************************************/
+void NisarRasterBand::EnsureCoverageSummary()
+{
+    if (!m_bIsMask || m_bCoverageChecked) return;
+    std::lock_guard<std::mutex> oLock(m_oCoverageMutex);
+    if (m_bCoverageChecked) return;
+    // Strip layouts and HDF5-decoded pipelines are read as they are
+    if (CPLTestBool(CPLGetConfigOption("NISAR_MASK_SUMMARY", "NO")) && !m_bRawLayout &&
+        m_oFilters.IsNative() && !m_aoAllChunks.empty()) {
+        BuildCoverageSummary();
+    }
+    m_bCoverageChecked = true;
+}
 
-    // Snap to rigid grid boundaries to prevent the "Creeping Window"
-    int nFetchXMin = (nBlockXOff / nPrefetchGrid) * nPrefetchGrid;
-    int nFetchYMin = (nBlockYOff / nPrefetchGrid) * nPrefetchGrid;
-    
-    int nFetchXMax = std::min(nFetchXMin + nPrefetchGrid - 1, nTotalBlocksX - 1);
-    int nFetchYMax = std::min(nFetchYMin + nPrefetchGrid - 1, nTotalBlocksY - 1);
+/************************************************************************/
+/*                        BuildCoverageSummary()                        */
+/* Decodes the mask chunks in batches (the mask compresses to a small   */
+/* fraction of any data layer) and summarizes the in-raster part of     */
+/* each. With NISAR_OVR_CACHE_DIR set, the summary is persisted next to */
+/* the overview sidecars under the same granule identity.               */
+/************************************************************************/
+void NisarRasterBand::BuildCoverageSummary()
+{
+    auto t_start = std::chrono::high_resolution_clock::now();
+    std::vector<NisarChunkInfo> aoChunks;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMegaFetchMutex);
+        aoChunks = m_aoAllChunks;
+    }
+    const size_t nChunks = aoChunks.size();
+    const std::string sRawPath = GetRawVSIPath();
+
+    const std::string osDir = NisarOverviewCache::GetCacheDirectory();
+    std::string osPath, osHeader;
+    if (!osDir.empty()) {
+        const std::string osIdentity = NisarOverviewCache::BuildIdentity(
+            sRawPath, get_hdf5_object_name(m_hDataset) + CPLSPrintf("|MASK_SUMMARY|%d", m_iSlice), 0,
+            nRasterXSize, nRasterYSize, GDT_Byte, false);
+        osPath = CPLFormFilename(osDir.c_str(), CPLSPrintf("nisar_msk_%016llx",
+                 static_cast<unsigned long long>(NisarOverviewCache::HashIdentity(osIdentity))), "bin");
+        osHeader = "NISAR_MASK_SUMMARY " + osIdentity + "\n";
+
+        GByte* pabyFile = nullptr;
+        vsi_l_offset nFileSize = 0;
+        VSIStatBufL sStat;
+        if (VSIStatL(osPath.c_str(), &sStat) == 0 &&
+            VSIIngestFile(nullptr, osPath.c_str(), &pabyFile, &nFileSize, 1 << 30)) {
+            if (nFileSize == osHeader.size() + nChunks && memcmp(pabyFile, osHeader.data(), osHeader.size()) == 0) {
+                m_abyChunkCoverage.assign(pabyFile + osHeader.size(), pabyFile + nFileSize);
+            }
+            CPLFree(pabyFile);
+        }
+    }
 
-    std::vector<NisarChunkInfo> aoMissingChunks;
-    std::vector<vsi_l_offset> anOffsets;
-    std::vector<size_t> anSizes;
+    const bool bLoaded = !m_abyChunkCoverage.empty();
+    if (!bLoaded) {
+        m_abyChunkCoverage.assign(nChunks, static_cast<GByte>(NisarMaskCoverage::Unknown));
+        const size_t nChunkBytes = static_cast<size_t>(m_nChunkXSize) * m_nChunkYSize;
+        auto Classify = [&](size_t idx, const GByte* pabyChunk, bool bUniform) {
+            const int nCX = static_cast<int>(idx % m_nChunksPerRow), nCY = static_cast<int>(idx / m_nChunksPerRow);
+            const int nCols = std::min(m_nChunkXSize, nRasterXSize - nCX * m_nChunkXSize);
+            const int nRows = std::min(m_nChunkYSize, nRasterYSize - nCY * m_nChunkYSize);
+            bool bValid = false, bInvalid = false;
+            for (int r = 0; r < (bUniform ? 1 : nRows) && !(bValid && bInvalid); r++) {
+                const GByte* pabyRow = pabyChunk + static_cast<size_t>(r) * m_nChunkXSize;
+                const size_t nLen = bUniform ? 1 : static_cast<size_t>(nCols);
+                bInvalid = bInvalid || memchr(pabyRow, 0, nLen) != nullptr;
+                bValid = bValid || memchr(pabyRow, 255, nLen) != nullptr;
+            }
+            m_abyChunkCoverage[idx] = static_cast<GByte>(bValid && bInvalid ? NisarMaskCoverage::Mixed :
+                                                         bValid ? NisarMaskCoverage::AllValid : NisarMaskCoverage::AllInvalid);
+        };
+
+        // Sparse and constant chunks are classified from their one pixel
+        std::vector<size_t> anStored;
+        for (size_t i = 0; i < nChunks; i++) {
+            if (aoChunks[i].bIsMissing || aoChunks[i].bIsConstant) {
+                GByte byValue = aoChunks[i].bIsMissing ? m_abyFillPixel[0] : aoChunks[i].abyConstant[0];
+                ApplyMaskLUT(m_eMaskType, &byValue, 1);
+                Classify(i, &byValue, true);
+            } else {
+                anStored.push_back(i);
+            }
+        }
 
-    // Scan the ALIGNED prefetch grid using the cached vector
-    for (int iY = nFetchYMin; iY <= nFetchYMax; iY++) {
-        for (int iX = nFetchXMin; iX <= nFetchXMax; iX++) {
-            
-            // Exclude already cached blocks from network fetch arrays
-            if (iX != nBlockXOff || iY != nBlockYOff) {
-                GDALRasterBlock *poBlock = TryGetLockedBlockRef(iX, iY);
-                if (poBlock != nullptr) {
-                    poBlock->DropLock();
-                    continue;
+        VSILFILE* fp = anStored.empty() ? nullptr : VSIFOpenL(sRawPath.c_str(), "rb");
+        std::vector<GByte> abyDecoded(nChunkBytes);
+        constexpr size_t nBatch = 64;
+        for (size_t iFirst = 0; fp && iFirst < anStored.size(); iFirst += nBatch) {
+            const size_t nCount = std::min(nBatch, anStored.size() - iFirst);
+            std::vector<std::vector<GByte>> aabyRaw(nCount);
+            std::vector<void*> apData(nCount);
+            std::vector<vsi_l_offset> anOffsets(nCount);
+            std::vector<size_t> anSizes(nCount);
+            for (size_t k = 0; k < nCount; k++) {
+                const auto& chunk = aoChunks[anStored[iFirst + k]];
+                aabyRaw[k].resize(chunk.nLength);
+                apData[k] = aabyRaw[k].data();
+                anOffsets[k] = chunk.nOffset;
+                anSizes[k] = chunk.nLength;
+            }
+            if (VSIFReadMultiRangeL(static_cast<int>(nCount), apData.data(), anOffsets.data(), anSizes.data(), fp) != 0) break;
+            for (size_t k = 0; k < nCount; k++) {
+                const auto& chunk = aoChunks[anStored[iFirst + k]];
+                // The mask rules are applied on decode: 0 or 255 per pixel
+                if (ProcessAndCopyChunk(aabyRaw[k].data(), aabyRaw[k].size(), chunk.nFilterMask, abyDecoded.data())) {
+                    Classify(anStored[iFirst + k], abyDecoded.data(), false);
                 }
             }
+        }
+        if (fp) VSIFCloseL(fp);
+
+        // Persist only complete summaries
+        const bool bComplete = std::none_of(m_abyChunkCoverage.begin(), m_abyChunkCoverage.end(),
+                                            [](GByte b) { return b == static_cast<GByte>(NisarMaskCoverage::Unknown); });
+        if (!osPath.empty() && bComplete) {
+            const std::string osPartial = osPath + CPLSPrintf(".%d.partial", CPLGetPID());
+            VSILFILE* fpOut = VSIFOpenL(osPartial.c_str(), "wb");
+            bool bOK = fpOut != nullptr;
+            if (bOK) {
+                bOK = VSIFWriteL(osHeader.data(), 1, osHeader.size(), fpOut) == osHeader.size() &&
+                      VSIFWriteL(m_abyChunkCoverage.data(), 1, nChunks, fpOut) == nChunks;
+                bOK = VSIFCloseL(fpOut) == 0 && bOK;
+            }
+            if (bOK) bOK = VSIRename(osPartial.c_str(), osPath.c_str()) == 0;
+            if (!bOK) VSIUnlink(osPartial.c_str());
+        }
+    }
+
+    // Uniform chunks are served like constant ones: no fetch, no inflate
+    size_t anCounts[4] = {0, 0, 0, 0};
+    {
+        std::lock_guard<std::mutex> oLock(m_oMegaFetchMutex);
+        for (size_t i = 0; i < nChunks; i++) {
+            const auto eCoverage = static_cast<NisarMaskCoverage>(m_abyChunkCoverage[i]);
+            anCounts[std::min<size_t>(m_abyChunkCoverage[i], 3)]++;
+            auto& chunk = m_aoAllChunks[i];
+            if (chunk.bIsMissing || chunk.bIsConstant ||
+                (eCoverage != NisarMaskCoverage::AllInvalid && eCoverage != NisarMaskCoverage::AllValid)) continue;
+            // A stored code the mask rules map to 0 or to 255
+            chunk.abyConstant[0] = (eCoverage == NisarMaskCoverage::AllInvalid) ? 0 :
+                                   (m_eMaskType == NisarMaskType::GUNW) ? 11 : 1;
+            chunk.bIsConstant = true;
+        }
+    }
+    std::chrono::duration<double, std::milli> t_diff = std::chrono::high_resolution_clock::now() - t_start;
+    CPLDebug("NISAR_DRIVER", "Mask summary (%s): %zu chunks all invalid, %zu all valid, %zu mixed, %zu unknown | Time: %.3f ms",
+             bLoaded ? "cached" : "built", anCounts[1], anCounts[2], anCounts[3], anCounts[0], t_diff.count());
+}
+
+/************************************************************************/
+/*                           GetMaskCoverage()                          */
+/* Combined coverage of the mask chunks under a window; Mixed until the */
+/* summary exists.                                                      */
+/************************************************************************/
+NisarMaskCoverage NisarRasterBand::GetMaskCoverage(int nXOff, int nYOff, int nXSize, int nYSize) const
+{
+    if (!m_bCoverageChecked || m_abyChunkCoverage.empty() || nXSize <= 0 || nYSize <= 0) return NisarMaskCoverage::Mixed;
+
+    const int nCX0 = nXOff / m_nChunkXSize, nCX1 = (nXOff + nXSize - 1) / m_nChunkXSize;
+    const int nCY0 = nYOff / m_nChunkYSize, nCY1 = (nYOff + nYSize - 1) / m_nChunkYSize;
+    NisarMaskCoverage eResult = NisarMaskCoverage::Unknown;
+    for (int nCY = nCY0; nCY <= nCY1; nCY++) {
+        for (int nCX = nCX0; nCX <= nCX1; nCX++) {
+            const size_t idx = static_cast<size_t>(nCY) * m_nChunksPerRow + nCX;
+            if (nCX >= m_nChunksPerRow || idx >= m_abyChunkCoverage.size()) return NisarMaskCoverage::Mixed;
+            const auto eChunk = static_cast<NisarMaskCoverage>(m_abyChunkCoverage[idx]);
+            if (eChunk != NisarMaskCoverage::AllInvalid && eChunk != NisarMaskCoverage::AllValid) return NisarMaskCoverage::Mixed;
+            if (eResult != NisarMaskCoverage::Unknown && eResult != eChunk) return NisarMaskCoverage::Mixed;
+            eResult = eChunk;
+        }
+    }
+    return eResult == NisarMaskCoverage::Unknown ? NisarMaskCoverage::Mixed : eResult;
+}
+
+NisarMaskCoverage NisarRasterBand::GetAppliedMaskCoverage(int nXOff, int nYOff, int nXSize, int nYSize) const
+{
+    if (!m_bApplyMask || !m_poMaskBand) return NisarMaskCoverage::Mixed;
+    // Clipped to the raster: padding of edge blocks is never masked
+    return m_poMaskBand->GetMaskCoverage(nXOff, nYOff, std::min(nXSize, nRasterXSize - nXOff),
+                                         std::min(nYSize, nRasterYSize - nYOff));
+}
+
+/************************************************************************/
+/*                            ApplyLayerMask()                          */
+/* Blends the masked value into one decoded block. pabyMask is the      */
+/* matching mask block when it was decoded in the same batch; otherwise */
+/* the mask window is read through the mask band.                       */
+/************************************************************************/
+bool NisarRasterBand::ApplyLayerMask(int nBlockX, int nBlockY, GByte* pabyBlock, const GByte* pabyMask)
+{
+    if (!m_bApplyMask) return true;
+
+    // Uniform blocks need neither the mask pixels nor the blend
+    const size_t nBlockPixels = static_cast<size_t>(nBlockXSize) * nBlockYSize;
+    const NisarMaskCoverage eCoverage = GetAppliedMaskCoverage(nBlockX * nBlockXSize, nBlockY * nBlockYSize,
+                                                               nBlockXSize, nBlockYSize);
+    if (eCoverage == NisarMaskCoverage::AllValid) return true;
+    if (eCoverage == NisarMaskCoverage::AllInvalid) {
+        GDALCopyWords64(m_abyMaskedPixel.data(), eDataType, 0, pabyBlock, eDataType,
+                        static_cast<int>(m_abyMaskedPixel.size()), static_cast<GPtrDiff_t>(nBlockPixels));
+        return true;
+    }
+
+    std::vector<GByte> abyMask;
+    if (pabyMask == nullptr) {
+        // Padding beyond the raster edge stays valid
+        abyMask.assign(nBlockPixels, 255);
+        const int nXOff = nBlockX * nBlockXSize, nYOff = nBlockY * nBlockYSize;
+        const int nXSize = std::min(nBlockXSize, nRasterXSize - nXOff);
+        const int nYSize = std::min(nBlockYSize, nRasterYSize - nYOff);
+        if (m_poMaskBand->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize, abyMask.data(), nXSize, nYSize,
+                                   GDT_Byte, 1, nBlockXSize, nullptr) != CE_None) {
+            return false;
+        }
+        pabyMask = abyMask.data();
+    }
+    BlendMaskedPixels(pabyBlock, static_cast<int>(m_abyMaskedPixel.size()), pabyMask, nBlockPixels,
+                      m_abyMaskedPixel.data());
+    return true;
+}
+
+/***************************************************************************/
+/*                          ReadSpanParallel()                             */
+/* Splits one large coalesced byte range into fixed-size parts fetched by  */
+/* a small pool of threads, each on its own VSILFILE handle (handles are   */
+/* not thread-safe). Every part lands at its final position in pDst. A     */
+/* part that comes back short is retried with exponential backoff on a     */
+/* freshly opened handle.                                                  */
+/*                                                                         */
+/* Tuning: NISAR_FETCH_PART_SIZE (bytes), NISAR_FETCH_CONCURRENCY,         */
+/*         NISAR_FETCH_RETRIES                                             */
+/***************************************************************************/
+static bool ReadSpanParallel(const std::string& sPath, vsi_l_offset nStart, size_t nSize,
+                             GByte* pDst, size_t nPartSize, int nConcurrency)
+{
+    const int nMaxRetries = std::max(0, atoi(CPLGetConfigOption("NISAR_FETCH_RETRIES", "3")));
+    const size_t nParts = (nSize + nPartSize - 1) / nPartSize;
+    const int nWorkers = static_cast<int>(std::min<size_t>(nParts, static_cast<size_t>(nConcurrency)));
+
+    std::atomic<size_t> nNextPart{0};
+    std::atomic<bool> bOK{true};
+    std::atomic<int> nRetriesUsed{0};
+
+    auto worker = [&]() {
+        VSILFILE* fpPart = VSIFOpenL(sPath.c_str(), "rb");
+        while (bOK) {
+            const size_t iPart = nNextPart.fetch_add(1);
+            if (iPart >= nParts) break;
+
+            const size_t nPartOffset = iPart * nPartSize;
+            const size_t nThisPart = std::min(nPartSize, nSize - nPartOffset);
+
+            bool bPartOK = false;
+            for (int iTry = 0; iTry <= nMaxRetries && !bPartOK; iTry++) {
+                if (iTry > 0) {
+                    nRetriesUsed++;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100 << std::min(iTry - 1, 5)));
+                    // Drop the handle: a stalled or reset connection is not reused
+                    if (fpPart) VSIFCloseL(fpPart);
+                    fpPart = VSIFOpenL(sPath.c_str(), "rb");
+                }
+                if (!fpPart) continue;
+                if (VSIFSeekL(fpPart, nStart + nPartOffset, SEEK_SET) == 0 &&
+                    VSIFReadL(pDst + nPartOffset, 1, nThisPart, fpPart) == nThisPart) {
+                    bPartOK = true;
+                }
+            }
+            if (!bPartOK) {
+                CPLDebug("NISAR_NET_PERF", "Part %zu (offset " CPL_FRMT_GUIB ", %zu bytes) failed after %d retries",
+                         iPart, static_cast<GUIntBig>(nStart + nPartOffset), nThisPart, nMaxRetries);
+                bOK = false;
+            }
+        }
+        if (fpPart) VSIFCloseL(fpPart);
+    };
+
+    std::vector<std::thread> aoThreads;
+    for (int t = 0; t < nWorkers; t++) aoThreads.emplace_back(worker);
+    for (auto& th : aoThreads) th.join();
+
+    if (nRetriesUsed > 0) {
+        CPLDebug("NISAR_NET_PERF", "Parallel fetch: %d part retries", nRetriesUsed.load());
+    }
+    return bOK;
+}
+
+/***************************************************************************/
+/*                         Hedged range fetcher                            */
+/* Tail-latency control for the multi-range path. Each chunk range is      */
+/* fetched on its own handle; a range still outstanding after the hedge    */
+/* delay (a percentile of recently observed range latencies) gets one      */
+/* duplicate request and the first response wins. With a read deadline,   */
+/* neighbour ranges not back in time are dropped (left uncached); the      */
+/* target range is always awaited.                                         */
+/*                                                                         */
+/* Fetch threads share only the fetch state, so a dropped or losing       */
+/* request finishes in the background without touching the band. Once the */
+/* caller gives up, primaries take no new range; the band joins the        */
+/* threads on its next hedged fetch and in its destructor.                 */
+/*                                                                         */
+/* Tuning: NISAR_HEDGE_REQUESTS, NISAR_HEDGE_PERCENTILE,                   */
+/*         NISAR_HEDGE_MIN_DELAY_MS, NISAR_READ_DEADLINE_MS                */
+/***************************************************************************/
+namespace {
+
+// Process-wide ring of recent range latencies (ms) used for the hedge threshold
+std::mutex g_oLatencyMutex;
+std::vector<double> g_adfLatencyRing;
+size_t g_nLatencyNext = 0;
+constexpr size_t NISAR_LATENCY_RING_SIZE = 512;
+constexpr size_t NISAR_LATENCY_MIN_SAMPLES = 20;
+
+void RecordRangeLatency(double dfMs)
+{
+    std::lock_guard<std::mutex> oLock(g_oLatencyMutex);
+    if (g_adfLatencyRing.size() < NISAR_LATENCY_RING_SIZE) {
+        g_adfLatencyRing.push_back(dfMs);
+    } else {
+        g_adfLatencyRing[g_nLatencyNext] = dfMs;
+        g_nLatencyNext = (g_nLatencyNext + 1) % NISAR_LATENCY_RING_SIZE;
+    }
+}
+
+double GetHedgeDelayMs(double dfPercentile, double dfMinDelayMs)
+{
+    std::vector<double> adfSorted;
+    {
+        std::lock_guard<std::mutex> oLock(g_oLatencyMutex);
+        adfSorted = g_adfLatencyRing;
+    }
+    // Not enough history yet: be conservative
+    if (adfSorted.size() < NISAR_LATENCY_MIN_SAMPLES) return std::max(dfMinDelayMs, 250.0);
+
+    const size_t nIdx = std::min(adfSorted.size() - 1,
+                                 static_cast<size_t>(dfPercentile / 100.0 * adfSorted.size()));
+    std::nth_element(adfSorted.begin(), adfSorted.begin() + nIdx, adfSorted.end());
+    return std::max(dfMinDelayMs, adfSorted[nIdx]);
+}
+
+struct HedgedRange {
+    vsi_l_offset nOffset = 0;
+    size_t nSize = 0;
+    void* pData = nullptr;     // CPLMalloc'd winner buffer, handed to the caller
+    bool bDone = false;
+    bool bFailed = false;      // Every issued attempt failed
+    int nIssued = 0;
+    int nFailedAttempts = 0;
+    std::chrono::steady_clock::time_point tStart;
+};
+
+struct HedgedFetchState {
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::string sPath;
+    std::vector<HedgedRange> aoRanges;
+    size_t nNextPrimary = 0;
+    bool bAbandoned = false;   // Caller gave up; late winners free their own buffer
+};
+
+void RunHedgedAttempt(std::shared_ptr<HedgedFetchState> poState, size_t iRange)
+{
+    vsi_l_offset nOffset;
+    size_t nSize;
+    {
+        std::lock_guard<std::mutex> oLock(poState->oMutex);
+        nOffset = poState->aoRanges[iRange].nOffset;
+        nSize = poState->aoRanges[iRange].nSize;
+    }
+
+    auto tStart = std::chrono::steady_clock::now();
+    void* pBuf = VSI_MALLOC_VERBOSE(nSize);
+    bool bOK = false;
+    if (pBuf) {
+        VSILFILE* fp = VSIFOpenL(poState->sPath.c_str(), "rb");
+        if (fp) {
+            bOK = VSIFSeekL(fp, nOffset, SEEK_SET) == 0 && VSIFReadL(pBuf, 1, nSize, fp) == nSize;
+            VSIFCloseL(fp);
+        }
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - tStart;
+    if (bOK) RecordRangeLatency(elapsed.count());
+
+    std::lock_guard<std::mutex> oLock(poState->oMutex);
+    auto& range = poState->aoRanges[iRange];
+    if (bOK && !range.bDone && !poState->bAbandoned) {
+        range.pData = pBuf;
+        range.bDone = true;
+        pBuf = nullptr;
+    } else if (!bOK) {
+        range.nFailedAttempts++;
+        if (range.nFailedAttempts >= range.nIssued && !range.bDone) range.bFailed = true;
+    }
+    CPLFree(pBuf);
+    poState->oCV.notify_all();
+}
+
+void RunHedgedPrimaryWorker(std::shared_ptr<HedgedFetchState> poState)
+{
+    for (;;) {
+        size_t iRange;
+        {
+            std::lock_guard<std::mutex> oLock(poState->oMutex);
+            // Skip ranges a hedge already answered
+            while (poState->nNextPrimary < poState->aoRanges.size() &&
+                   poState->aoRanges[poState->nNextPrimary].bDone) {
+                poState->nNextPrimary++;
+            }
+            if (poState->bAbandoned || poState->nNextPrimary >= poState->aoRanges.size()) return;
+            iRange = poState->nNextPrimary++;
+            auto& range = poState->aoRanges[iRange];
+            range.nIssued++;
+            range.tStart = std::chrono::steady_clock::now();
+        }
+        RunHedgedAttempt(poState, iRange);
+    }
+}
+
+// Completion latch between the io_uring reaper and the decode pool:
+// decode workers block on their own range, not on the whole batch.
+struct RangeCompletionLatch {
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::vector<int> anState; // 0 pending, 1 ready, -1 failed
+
+    explicit RangeCompletionLatch(size_t nRanges) : anState(nRanges, 0) {}
+
+    void Signal(size_t i, bool bOK)
+    {
+        {
+            std::lock_guard<std::mutex> oLock(oMutex);
+            if (anState[i] == 0) anState[i] = bOK ? 1 : -1;
+        }
+        oCV.notify_all();
+    }
+
+    bool Wait(size_t i)
+    {
+        std::unique_lock<std::mutex> oLock(oMutex);
+        oCV.wait(oLock, [this, i] { return anState[i] != 0; });
+        return anState[i] > 0;
+    }
+};
+
+} // namespace
+
+void NisarRasterBand::StartFetchThread(std::function<void()> fnWork)
+{
+    auto pbFinished = std::make_shared<std::atomic<bool>>(false);
+    std::thread oThread([fnWork = std::move(fnWork), pbFinished]() {
+        fnWork();
+        *pbFinished = true;
+    });
+    std::lock_guard<std::mutex> oLock(m_oFetchThreadsMutex);
+    m_aoFetchThreads.push_back({std::move(oThread), pbFinished});
+}
+
+// bAll = false: only threads whose request already finished
+void NisarRasterBand::JoinFetchThreads(bool bAll)
+{
+    std::vector<FetchThread> aoJoin;
+    {
+        std::lock_guard<std::mutex> oLock(m_oFetchThreadsMutex);
+        auto oIter = std::partition(m_aoFetchThreads.begin(), m_aoFetchThreads.end(),
+                                    [bAll](const FetchThread& o) { return !bAll && !*o.pbFinished; });
+        std::move(oIter, m_aoFetchThreads.end(), std::back_inserter(aoJoin));
+        m_aoFetchThreads.erase(oIter, m_aoFetchThreads.end());
+    }
+    for (auto& o : aoJoin) o.oThread.join();
+}
+
+/***************************************************************************/
+/*                          FetchRangesHedged()                            */
+/* Fills apData[i] with a CPLMalloc'd copy of range i, or nullptr for a    */
+/* neighbour dropped at the deadline. Returns false if any range flagged   */
+/* in abRequired (the target block's chunks) could not be read.            */
+/***************************************************************************/
+bool NisarRasterBand::FetchRangesHedged(const std::string& sPath,
+                                        const std::vector<vsi_l_offset>& anOffsets,
+                                        const std::vector<size_t>& anSizes,
+                                        std::vector<void*>& apData,
+                                        const std::vector<bool>& abRequired)
+{
+    // Requests left over from earlier fetches
+    JoinFetchThreads(false);
+
+    const double dfPercentile = std::min(99.9, std::max(50.0, CPLAtof(CPLGetConfigOption("NISAR_HEDGE_PERCENTILE", "95"))));
+    const double dfMinDelayMs = std::max(0.0, CPLAtof(CPLGetConfigOption("NISAR_HEDGE_MIN_DELAY_MS", "50")));
+    const bool bHedge = CPLTestBool(CPLGetConfigOption("NISAR_HEDGE_REQUESTS", "NO"));
+    const double dfDeadlineMs = CPLAtof(CPLGetConfigOption("NISAR_READ_DEADLINE_MS", "0"));
+    const int nConcurrency = std::max(1, atoi(CPLGetConfigOption("NISAR_FETCH_CONCURRENCY", "8")));
+    const double dfHedgeDelayMs = GetHedgeDelayMs(dfPercentile, dfMinDelayMs);
+
+    // Issue the target's ranges first so they are never queued behind neighbours
+    std::vector<size_t> anOrder;
+    for (size_t i = 0; i < anOffsets.size(); i++) if (abRequired[i]) anOrder.push_back(i);
+    const size_t nRequired = anOrder.size();
+    for (size_t i = 0; i < anOffsets.size(); i++) if (!abRequired[i]) anOrder.push_back(i);
+
+    auto poState = std::make_shared<HedgedFetchState>();
+    poState->sPath = sPath;
+    poState->aoRanges.resize(anOffsets.size());
+    for (size_t i = 0; i < anOrder.size(); i++) {
+        poState->aoRanges[i].nOffset = anOffsets[anOrder[i]];
+        poState->aoRanges[i].nSize = anSizes[anOrder[i]];
+    }
+
+    const int nWorkers = static_cast<int>(std::min<size_t>(anOffsets.size(), static_cast<size_t>(nConcurrency)));
+    for (int t = 0; t < nWorkers; t++) {
+        StartFetchThread([poState]() { RunHedgedPrimaryWorker(poState); });
+    }
+
+    const auto tStart = std::chrono::steady_clock::now();
+    int nHedges = 0;
+    bool bTargetOK = true;
+    size_t nDropped = 0;
+    {
+        std::unique_lock<std::mutex> oLock(poState->oMutex);
+        for (;;) {
+            const auto tNow = std::chrono::steady_clock::now();
+            std::chrono::duration<double, std::milli> waited = tNow - tStart;
+
+            bool bAllSettled = true;
+            bool bTargetSettled = true;
+            for (size_t i = 0; i < poState->aoRanges.size(); i++) {
+                auto& range = poState->aoRanges[i];
+                const bool bSettled = range.bDone || range.bFailed;
+                if (!bSettled) bAllSettled = false;
+                if (i < nRequired && !bSettled) bTargetSettled = false;
+
+                // One duplicate per straggling range
+                if (bHedge && !bSettled && range.nIssued == 1) {
+                    std::chrono::duration<double, std::milli> age = tNow - range.tStart;
+                    if (age.count() > dfHedgeDelayMs) {
+                        range.nIssued++;
+                        nHedges++;
+                        StartFetchThread([poState, i]() { RunHedgedAttempt(poState, i); });
+                    }
+                }
+            }
+            if (bAllSettled) break;
+            if (dfDeadlineMs > 0 && waited.count() >= dfDeadlineMs && bTargetSettled) break;
+
+            // Wake for completions, and periodically to evaluate hedges/deadline
+            double dfWaitMs = bHedge ? std::max(1.0, dfHedgeDelayMs / 4) : 50.0;
+            if (dfDeadlineMs > 0 && waited.count() < dfDeadlineMs) {
+                dfWaitMs = std::min(dfWaitMs, dfDeadlineMs - waited.count());
+            }
+            poState->oCV.wait_for(oLock, std::chrono::duration<double, std::milli>(std::max(1.0, dfWaitMs)));
+        }
+
+        for (size_t i = 0; i < poState->aoRanges.size(); i++) {
+            auto& range = poState->aoRanges[i];
+            apData[anOrder[i]] = range.pData;
+            range.pData = nullptr;
+            if (!range.bDone) nDropped++;
+            if (i < nRequired && !range.bDone) bTargetOK = false;
+        }
+        poState->bAbandoned = true;
+    }
 
-            int idx = iY * nTotalBlocksX + iX;
-            if (idx >= 0 && idx < static_cast<int>(m_aoAllChunks.size())) {
-                const auto& chunk = m_aoAllChunks[idx];
-                if (!chunk.bIsMissing) {
-                    aoMissingChunks.push_back({iX, iY, chunk.nOffset, chunk.nLength, false});
+    if (nHedges > 0 || nDropped > 0) {
+        CPLDebug("NISAR_NET_PERF", "Hedged fetch: %zu ranges, %d hedges (delay %.1f ms), %zu dropped",
+                 anOffsets.size(), nHedges, dfHedgeDelayMs, nDropped);
+    }
+    return bTargetOK;
+}
+
+/***************************************************************************/
+/*                             IReadBlock()                                */
+/* This method reads a block of data from the HDF5 dataset.                */
+/***************************************************************************/
+CPLErr NisarRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
+{
+    // Mask chunk summary (NISAR_MASK_SUMMARY), built before any index is locked
+    if (m_bIsMask) EnsureCoverageSummary();
+    else if (m_bApplyMask) m_poMaskBand->EnsureCoverageSummary();
+
+    // We lock to ensure the network arrays build cleanly, but we will 
+    // manually drop this lock before we touch the GDAL Block Cache.
+    std::unique_lock<std::mutex> oLock(m_oMegaFetchMutex);
+
+    // -------------------------------------------------------------
+    // ALIGNED PREFETCH EXPANSION (Mega-Fetch)
+    // -------------------------------------------------------------
+
+    // Default to 1 (No prefetching) for dynamic TiTiler web serving and windowed reads.
+    // Can be overridden to 24 via environment variable for full-frame AWS Batch jobs.
+
+    int nPrefetchGrid = atoi(CPLGetConfigOption("NISAR_PREFETCH_GRID", "1"));
+    if (nPrefetchGrid < 1 || bDisablePrefetch) nPrefetchGrid = 1;
+
+    int nTotalBlocksX = (nRasterXSize + nBlockXSize - 1) / nBlockXSize;
+    int nTotalBlocksY = (nRasterYSize + nBlockYSize - 1) / nBlockYSize;
+
+    // Snap to rigid grid boundaries to prevent the "Creeping Window"
+    int nFetchXMin = (nBlockXOff / nPrefetchGrid) * nPrefetchGrid;
+    int nFetchYMin = (nBlockYOff / nPrefetchGrid) * nPrefetchGrid;
+    
+    int nFetchXMax = std::min(nFetchXMin + nPrefetchGrid - 1, nTotalBlocksX - 1);
+    int nFetchYMax = std::min(nFetchYMin + nPrefetchGrid - 1, nTotalBlocksY - 1);
+
+    // Synthetic blocks (BLOCK_MULTIPLE / BLOCK_SIZE) span nMultX x nMultY chunks
+    const int nMultX = nBlockXSize / m_nChunkXSize;
+    const int nMultY = nBlockYSize / m_nChunkYSize;
+
+    struct PlannedBlock {
+        NisarRasterBand* poBand;  // This band, or a co-fetched polarization
+        int nBlockX;
+        int nBlockY;
+        size_t iFirstChunk;  // Constituent chunks in aoMissingChunks
+        size_t iEndChunk;
+        int iMaskBlock = -1;      // APPLY_MASK: the mask block in aoBlocks
+        bool bFusedMask = false;  // Decoded only to be blended, never cached
+    };
+    std::vector<PlannedBlock> aoBlocks;
+    std::vector<NisarChunkInfo> aoMissingChunks;
+    std::vector<int> anRangeIdx;  // Per chunk: index into anOffsets, -1 if sparse
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    std::vector<bool> abTargetRange;
+
+    // Caller holds poOwner->m_oMegaFetchMutex
+    int nMaskedOutChunks = 0;
+    auto PlanBlock = [&](NisarRasterBand* poOwner, int iX, int iY, bool bIsTarget) {
+        PlannedBlock oBlock = {poOwner, iX, iY, aoMissingChunks.size(), 0, -1, false};
+        const auto& aoIndex = poOwner->m_aoAllChunks;
+        for (int iCY = 0; iCY < nMultY; iCY++) {
+            for (int iCX = 0; iCX < nMultX; iCX++) {
+                const int nChunkX = iX * nMultX + iCX;
+                const int nChunkY = iY * nMultY + iCY;
+                const int idx = nChunkY * m_nChunksPerRow + nChunkX;
+                if (poOwner->GetAppliedMaskCoverage(nChunkX * m_nChunkXSize, nChunkY * m_nChunkYSize, m_nChunkXSize,
+                                                    m_nChunkYSize) == NisarMaskCoverage::AllInvalid) {
+                    // APPLY_MASK over an all-invalid mask chunk: the blend overwrites it all
+                    aoMissingChunks.push_back({nChunkX, nChunkY, 0, 0, true});
+                    anRangeIdx.push_back(-1);
+                    nMaskedOutChunks++;
+                } else if (nChunkX < m_nChunksPerRow && nChunkY < m_nChunksPerCol &&
+                    idx < static_cast<int>(aoIndex.size()) && aoIndex[idx].bIsConstant) {
+                    // Constant chunk: replicated from its pixel, nothing to fetch
+                    NisarChunkInfo oConstant = aoIndex[idx];
+                    oConstant.nBlockX = nChunkX;
+                    oConstant.nBlockY = nChunkY;
+                    aoMissingChunks.push_back(oConstant);
+                    anRangeIdx.push_back(-1);
+                } else if (nChunkX < m_nChunksPerRow && nChunkY < m_nChunksPerCol &&
+                    idx < static_cast<int>(aoIndex.size()) && !aoIndex[idx].bIsMissing) {
+                    const auto& chunk = aoIndex[idx];
+                    aoMissingChunks.push_back({nChunkX, nChunkY, chunk.nOffset, chunk.nLength, false, chunk.nFilterMask});
+                    anRangeIdx.push_back(static_cast<int>(anOffsets.size()));
                     anOffsets.push_back(chunk.nOffset);
                     anSizes.push_back(chunk.nLength);
+                    abTargetRange.push_back(bIsTarget);
                 } else {
-                    aoMissingChunks.push_back({iX, iY, 0, 0, true});
+                    // Sparse chunk, or padding beyond the last chunk column/row
+                    aoMissingChunks.push_back({nChunkX, nChunkY, 0, 0, true});
+                    anRangeIdx.push_back(-1);
+                }
+            }
+        }
+        oBlock.iEndChunk = aoMissingChunks.size();
+        aoBlocks.push_back(oBlock);
+    };
+
+    // Scan the ALIGNED prefetch grid using the cached vector
+    for (int iY = nFetchYMin; iY <= nFetchYMax; iY++) {
+        for (int iX = nFetchXMin; iX <= nFetchXMax; iX++) {
+            
+            // Exclude already cached blocks from network fetch arrays
+            const bool bIsTarget = (iX == nBlockXOff && iY == nBlockYOff);
+            if (!bIsTarget) {
+                GDALRasterBlock *poBlock = TryGetLockedBlockRef(iX, iY);
+                if (poBlock != nullptr) {
+                    poBlock->DropLock();
+                    continue;
                 }
-            } else {
-                aoMissingChunks.push_back({iX, iY, 0, 0, true}); 
             }
+            PlanBlock(this, iX, iY, bIsTarget);
         }
     }
 
+    // Filters without a native decoder: let HDF5 run its own pipeline
+    if (!m_oFilters.IsNative()) {
+        std::vector<std::pair<int, int>> aoBlockXY;
+        for (const auto& block : aoBlocks) aoBlockXY.emplace_back(block.nBlockX, block.nBlockY);
+        oLock.unlock();
+        return ReadBlocksThroughHDF5(aoBlockXY, nBlockXOff, nBlockYOff, pImage);
+    }
+
+    // -------------------------------------------------------------
+    // POLARIZATION AND MASK CO-FETCH
+    // -------------------------------------------------------------
+    // The same blocks of the other terms (POL=ALL / POL=list) and of the
+    // layer mask join this read and are injected into their bands' caches,
+    // so an RGB tile costs one fetch, not three, and masking costs none.
+    auto poGDS = static_cast<NisarDataset*>(poDS);
+    std::vector<NisarRasterBand*> apoSiblings;
+    if (!bDisablePrefetch) {
+        const bool bPolCoFetch = poGDS->m_ahPolDatasets.size() > 1 &&
+                                 CPLTestBool(CPLGetConfigOption("NISAR_POL_COFETCH", "YES"));
+        const bool bMaskCoFetch = CPLTestBool(CPLGetConfigOption("NISAR_MASK_COFETCH", "YES"));
+        if (!m_bIsMask) {
+            for (int iBand = 1; bPolCoFetch && iBand <= poGDS->GetRasterCount(); iBand++) {
+                if (iBand != nBand) apoSiblings.push_back(static_cast<NisarRasterBand*>(poGDS->GetRasterBand(iBand)));
+            }
+            // Under APPLY_MASK the mask is fused below instead
+            if (bMaskCoFetch && m_poMaskBand && !m_bApplyMask) apoSiblings.push_back(m_poMaskBand);
+        } else if (bMaskCoFetch && !poGDS->m_bApplyMask) {
+            // A shared mask brings every term along only when they co-fetch anyway
+            for (int iBand = 1; iBand <= poGDS->GetRasterCount(); iBand++) {
+                if (bPolCoFetch || iBand == m_iSlice + 1) {
+                    apoSiblings.push_back(static_cast<NisarRasterBand*>(poGDS->GetRasterBand(iBand)));
+                }
+            }
+        }
+    }
+    // Same block and chunk grid, decoded natively out of the same file
+    auto IsCoFetchable = [this](const NisarRasterBand* poOther) {
+        return poOther != this && poOther->m_oFilters.IsNative() &&
+               poOther->m_abyCompactData.empty() && m_abyCompactData.empty() &&
+               poOther->nBlockXSize == nBlockXSize && poOther->nBlockYSize == nBlockYSize &&
+               poOther->m_nChunkXSize == m_nChunkXSize && poOther->m_nChunkYSize == m_nChunkYSize;
+    };
+    if (!apoSiblings.empty()) {
+        const size_t nOwnBlocks = aoBlocks.size();
+        int nCoFetched = 0;
+        for (NisarRasterBand* poSibling : apoSiblings) {
+            if (!IsCoFetchable(poSibling)) continue;
+
+            // Never wait for a sibling's index: its own read may hold it and want ours
+            std::unique_lock<std::mutex> oSiblingLock(poSibling->m_oMegaFetchMutex, std::try_to_lock);
+            if (!oSiblingLock.owns_lock()) continue;
+            const size_t nBefore = aoBlocks.size();
+            for (size_t b = 0; b < nOwnBlocks; b++) {
+                const int iX = aoBlocks[b].nBlockX, iY = aoBlocks[b].nBlockY;
+                GDALRasterBlock* poBlock = poSibling->TryGetLockedBlockRef(iX, iY);
+                if (poBlock) { poBlock->DropLock(); continue; }
+                PlanBlock(poSibling, iX, iY, false);
+            }
+            if (aoBlocks.size() > nBefore) nCoFetched++;
+        }
+        if (aoBlocks.size() > nOwnBlocks) {
+            CPLDebug("NISAR_DRIVER", "Band %d: co-fetching %zu blocks of %d sibling/mask bands.", nBand,
+                     aoBlocks.size() - nOwnBlocks, nCoFetched);
+        }
+    }
+
+    // -------------------------------------------------------------
+    // FUSED MASK (APPLY_MASK=YES)
+    // -------------------------------------------------------------
+    // The mask block of every planned data block is fetched in the same
+    // batch and blended in before injection; it is never cached itself.
+    // Masks on another grid are read through the mask band instead.
+    if (!m_bIsMask) {
+        const size_t nDataBlocks = aoBlocks.size();
+        std::vector<NisarRasterBand*> apoMasks;
+        for (size_t b = 0; b < nDataBlocks; b++) {
+            NisarRasterBand* poMask = aoBlocks[b].poBand->m_bApplyMask ? aoBlocks[b].poBand->m_poMaskBand : nullptr;
+            if (poMask && IsCoFetchable(poMask) && std::find(apoMasks.begin(), apoMasks.end(), poMask) == apoMasks.end()) {
+                apoMasks.push_back(poMask);
+            }
+        }
+        // One mask index at a time: its readers never wait on a data band
+        for (NisarRasterBand* poMask : apoMasks) {
+            std::lock_guard<std::mutex> oMaskLock(poMask->m_oMegaFetchMutex);
+            for (size_t b = 0; b < nDataBlocks; b++) {
+                if (!aoBlocks[b].poBand->m_bApplyMask || aoBlocks[b].poBand->m_poMaskBand != poMask) continue;
+                const int iX = aoBlocks[b].nBlockX, iY = aoBlocks[b].nBlockY;
+                // A shared mask block serves every term at its position
+                for (size_t m = nDataBlocks; m < aoBlocks.size() && aoBlocks[b].iMaskBlock < 0; m++) {
+                    if (aoBlocks[m].poBand == poMask && aoBlocks[m].nBlockX == iX && aoBlocks[m].nBlockY == iY) {
+                        aoBlocks[b].iMaskBlock = static_cast<int>(m);
+                    }
+                }
+                if (aoBlocks[b].iMaskBlock >= 0) continue;
+                // Uniform under the mask summary: ApplyLayerMask needs no pixels
+                if (aoBlocks[b].poBand->GetAppliedMaskCoverage(iX * nBlockXSize, iY * nBlockYSize, nBlockXSize,
+                                                               nBlockYSize) != NisarMaskCoverage::Mixed) continue;
+                const bool bIsTarget = (aoBlocks[b].poBand == this && iX == nBlockXOff && iY == nBlockYOff);
+                aoBlocks[b].iMaskBlock = static_cast<int>(aoBlocks.size());
+                PlanBlock(poMask, iX, iY, bIsTarget);
+                aoBlocks.back().bFusedMask = true;
+            }
+        }
+    }
+
+    if (nMaskedOutChunks > 0) {
+        CPLDebug("NISAR_DRIVER", "Band %d: %d chunks skipped under all-invalid mask chunks.", nBand, nMaskedOutChunks);
+    }
+
     // Perform Concurrent Network I/O
     if (!anOffsets.empty()) {
         std::string sRawPath = GetRawVSIPath();
-        VSILFILE* fp = VSIFOpenL(sRawPath.c_str(), "rb");
-        
-        if (fp) {
-            vsi_l_offset nMinOffset = anOffsets[0];
-            vsi_l_offset nMaxOffset = anOffsets[0] + anSizes[0];
-            // DECLARE the accumulator variable here, initialized with the first chunk size
-            size_t nTotalRequestedBytes = anSizes[0];
-            for (size_t i = 1; i < anOffsets.size(); i++) {
-                if (anOffsets[i] < nMinOffset) nMinOffset = anOffsets[i];
-                if (anOffsets[i] + anSizes[i] > nMaxOffset) nMaxOffset = anOffsets[i] + anSizes[i];
-                
-                nTotalRequestedBytes += anSizes[i];
-            }
-            
-            size_t nTotalSpan = static_cast<size_t>(nMaxOffset - nMinOffset);
-            void* pMegaBuffer = nullptr;
-            std::vector<void*> apData; 
-            
-            // Only trigger MegaFetch if the span is less than NISAR_MAX_MEGAFETCH_BYTES AND 
-            // the data we actually want makes up at least 50% of that span.
-            // This prevents downloading massive byte gaps of non-requested data.
-            // Default to 16 MB if the environment variable is not set by the user.
-            // CPLGetConfigOption returns a string, so we convert it to an integer, then cast to size_t.
-            size_t nMaxMegaFetchBytes = static_cast<size_t>(atoll(CPLGetConfigOption("NISAR_MAX_MEGAFETCH_BYTES", "16777216")));
 
-            // Evaluate using the dynamic threshold
-            bool bIsMegaFetch = (nTotalSpan < nMaxMegaFetchBytes) && (nTotalRequestedBytes > (nTotalSpan / 2));
+        // Compact layers are decoded from their in-memory copy like a mapping
+        const bool bCompact = !m_abyCompactData.empty();
+
+        // Local granules on io_uring-capable hosts: submit every range at once
+        const bool bUseIOUring = !bCompact && !STARTS_WITH_CI(sRawPath.c_str(), "/vsi") &&
+                                 CPLTestBool(CPLGetConfigOption("NISAR_USE_IO_URING", "NO")) &&
+                                 NisarLocalIO::IsIOUringAvailable();
+
+        // Local granules: decode straight out of a shared read-only mapping
+        size_t nMapSize = bCompact ? m_abyCompactData.size() : 0;
+        const GByte* pMappedBase = bCompact ? m_abyCompactData.data() : bUseIOUring ? nullptr :
+            static_cast<NisarDataset*>(poDS)->GetMappedFile(sRawPath, &nMapSize);
+        for (size_t i = 0; pMappedBase && i < anOffsets.size(); i++) {
+            if (anOffsets[i] + anSizes[i] > nMapSize) pMappedBase = nullptr; // Index beyond EOF: use VSI
+        }
 
+        vsi_l_offset nMinOffset = anOffsets[0];
+        vsi_l_offset nMaxOffset = anOffsets[0] + anSizes[0];
+        // DECLARE the accumulator variable here, initialized with the first chunk size
+        size_t nTotalRequestedBytes = anSizes[0];
+        for (size_t i = 1; i < anOffsets.size(); i++) {
+            if (anOffsets[i] < nMinOffset) nMinOffset = anOffsets[i];
+            if (anOffsets[i] + anSizes[i] > nMaxOffset) nMaxOffset = anOffsets[i] + anSizes[i];
+            
+            nTotalRequestedBytes += anSizes[i];
+        }
+        
+        size_t nTotalSpan = static_cast<size_t>(nMaxOffset - nMinOffset);
+        void* pMegaBuffer = nullptr;
+        std::vector<void*> apData; 
+        
+        // Only trigger MegaFetch if the span is less than NISAR_MAX_MEGAFETCH_BYTES AND 
+        // the data we actually want makes up at least 50% of that span.
+        // This prevents downloading massive byte gaps of non-requested data.
+        // Default to 16 MB if the environment variable is not set by the user.
+        // CPLGetConfigOption returns a string, so we convert it to an integer, then cast to size_t.
+        size_t nMaxMegaFetchBytes = static_cast<size_t>(atoll(CPLGetConfigOption("NISAR_MAX_MEGAFETCH_BYTES", "16777216")));
+
+        // Evaluate using the dynamic threshold
+        bool bIsMegaFetch = !pMappedBase && !bUseIOUring && (nTotalSpan < nMaxMegaFetchBytes) && (nTotalRequestedBytes > (nTotalSpan / 2));
+
+        // Large spans are split into parallel sub-range requests so a
+        // single TCP stream does not cap throughput.
+        const size_t nPartSize = static_cast<size_t>(atoll(CPLGetConfigOption("NISAR_FETCH_PART_SIZE", "8388608")));
+        const int nFetchConcurrency = atoi(CPLGetConfigOption("NISAR_FETCH_CONCURRENCY", "8"));
+        const bool bIsParallelFetch = bIsMegaFetch && nPartSize > 0 && nFetchConcurrency > 1 && nTotalSpan > nPartSize;
+
+        // Hedging / deadlines only apply to the multi-range path
+        const bool bIsHedgedFetch = !pMappedBase && !bUseIOUring && !bIsMegaFetch &&
+            (CPLTestBool(CPLGetConfigOption("NISAR_HEDGE_REQUESTS", "NO")) ||
+             CPLAtof(CPLGetConfigOption("NISAR_READ_DEADLINE_MS", "0")) > 0);
+
+        // Hedged and parallel fetches open their own handles per request
+        const bool bSharedHandle = !pMappedBase && !bUseIOUring && !bIsHedgedFetch && !bIsParallelFetch;
+        VSILFILE* fp = bSharedHandle ? VSIFOpenL(sRawPath.c_str(), "rb") : nullptr;
+
+        if (fp || !bSharedHandle) {
             // START NETWORK TIMING
             auto net_start_time = std::chrono::high_resolution_clock::now();
 
-            if (bIsMegaFetch) {
+            // io_uring: reads complete on a reaper thread while the decode
+            // pool below consumes them range by range.
+            std::vector<NisarLocalIO::LocalReadRequest> aoUringRequests;
+            std::unique_ptr<RangeCompletionLatch> poUringLatch;
+            std::thread oUringReaper;
+
+            if (bUseIOUring) {
+                aoUringRequests.resize(anOffsets.size());
+                for (size_t i = 0; i < anOffsets.size(); i++) {
+                    aoUringRequests[i].nOffset = anOffsets[i];
+                    aoUringRequests[i].nSize = anSizes[i];
+                }
+                poUringLatch.reset(new RangeCompletionLatch(anOffsets.size()));
+                const int nQueueDepth = atoi(CPLGetConfigOption("NISAR_IO_URING_QUEUE_DEPTH", "64"));
+                const bool bDirect = CPLTestBool(CPLGetConfigOption("NISAR_IO_URING_DIRECT", "NO"));
+                RangeCompletionLatch* poLatch = poUringLatch.get();
+                oUringReaper = std::thread([&sRawPath, &aoUringRequests, poLatch, nQueueDepth, bDirect]() {
+                    NisarLocalIO::ReadBatchIOUring(sRawPath, aoUringRequests, nQueueDepth, bDirect,
+                                                   [poLatch](size_t i, bool bOK) { poLatch->Signal(i, bOK); });
+                });
+            } else if (pMappedBase) {
+                // Prefetch plan -> page-in hints. Dense plans are advised as
+                // one span, sparse ones range by range.
+                auto poNisarDS = static_cast<NisarDataset*>(poDS);
+                if (!bCompact && anOffsets.size() > 1) {
+                    if (nTotalRequestedBytes > nTotalSpan / 2) {
+                        poNisarDS->AdviseMappedRange(nMinOffset, nTotalSpan);
+                    } else {
+                        for (size_t i = 0; i < anOffsets.size(); i++) poNisarDS->AdviseMappedRange(anOffsets[i], anSizes[i]);
+                    }
+                }
+            } else if (bIsMegaFetch) {
                 pMegaBuffer = CPLMalloc(nTotalSpan);
-                VSIFSeekL(fp, nMinOffset, SEEK_SET);
-                VSIFReadL(pMegaBuffer, 1, nTotalSpan, fp);
+                if (bIsParallelFetch) {
+                    if (!ReadSpanParallel(sRawPath, nMinOffset, nTotalSpan, static_cast<GByte*>(pMegaBuffer),
+                                          nPartSize, nFetchConcurrency)) {
+                        CPLError(CE_Failure, CPLE_FileIO,
+                                 "NISAR: Parallel range fetch of %zu bytes at offset " CPL_FRMT_GUIB " failed.",
+                                 nTotalSpan, static_cast<GUIntBig>(nMinOffset));
+                        CPLFree(pMegaBuffer);
+                        if (fp) VSIFCloseL(fp);
+                        return CE_Failure;
+                    }
+                } else {
+                    VSIFSeekL(fp, nMinOffset, SEEK_SET);
+                    VSIFReadL(pMegaBuffer, 1, nTotalSpan, fp);
+                }
+            } else if (bIsHedgedFetch) {
+                apData.resize(anOffsets.size(), nullptr);
+                if (!FetchRangesHedged(sRawPath, anOffsets, anSizes, apData, abTargetRange)) {
+                    CPLError(CE_Failure, CPLE_FileIO, "NISAR: Failed to fetch chunk for block (%d, %d).",
+                             nBlockXOff, nBlockYOff);
+                    for (void* p : apData) CPLFree(p);
+                    if (fp) VSIFCloseL(fp);
+                    return CE_Failure;
+                }
             } else {
                 apData.resize(anOffsets.size(), nullptr);
                 // IMPLEMENT ACCURATE MEMORY ALLOCATION FOR MULTI-RANGE POINTERS
@@ -890,7 +2345,7 @@ CPLErr NisarRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
                 }
                 VSIFReadMultiRangeL(static_cast<int>(anOffsets.size()), apData.data(), anOffsets.data(), anSizes.data(), fp);
             }
-            VSIFCloseL(fp);
+            if (fp) VSIFCloseL(fp);
 
             // Relinquish network lock early to free up standard I/O concurrency
             oLock.unlock();
@@ -908,27 +2363,27 @@ CPLErr NisarRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
             double dSeconds = net_elapsed.count() / 1000.0;
             double dThroughputMBps = dMegabytes / dSeconds;
 
+            // io_uring reports its own throughput once the batch drains
+            if (!bUseIOUring)
             CPLDebug("NISAR_NET_PERF", 
                      "[%s] Chunks: %d | Downloaded: %.2f MB | Throughput: %.2f MB/s",
-                     bIsMegaFetch ? "MEGA-FETCH " : "MULTI-RANGE", 
+                     bCompact ? "COMPACT    " : pMappedBase ? "MMAP       " :
+                     bIsParallelFetch ? "PARALLEL-FETCH" : (bIsMegaFetch ? "MEGA-FETCH " : (bIsHedgedFetch ? "HEDGED     " : "MULTI-RANGE")), 
                      static_cast<int>(anOffsets.size()), dMegabytes, dThroughputMBps);
 
             // 4. THREAD-ISOLATED DECOMPRESSION STAGING AREA
             std::atomic<bool> bSuccess{true};
-            const size_t nExpectedBytes = static_cast<size_t>(nBlockXSize) * nBlockYSize * GDALGetDataTypeSizeBytes(eDataType);
 
             // Thread-safe storage container to house intermediate states
-            struct DecompressedChunk {
-                int nBlockX;
-                int nBlockY;
+            struct DecompressedBlock {
                 std::vector<GByte> osData;
-                bool bIsTarget;
-                bool bIsMissing;
+                bool bIsTarget = false;
                 bool bValid = false;
+                bool bDecodedInPlace = false; // Target decoded directly into pImage
             };
 
-            const int nChunks = static_cast<int>(aoMissingChunks.size());
-            std::vector<DecompressedChunk> aoOutputs(nChunks);
+            const int nPlanned = static_cast<int>(aoBlocks.size());
+            std::vector<DecompressedBlock> aoOutputs(nPlanned);
 
             int nNumThreads = std::thread::hardware_concurrency();
             if (nNumThreads <= 0) nNumThreads = 4;
@@ -937,47 +2392,65 @@ CPLErr NisarRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
                 nNumThreads = atoi(pszNumThreads);
                 if (nNumThreads <= 0) nNumThreads = 1;
             }
-            int nThreadsToUse = std::min(nNumThreads, nChunks);
+            int nThreadsToUse = std::min(nNumThreads, nPlanned);
 
             std::vector<std::thread> workers;
             for (int t = 0; t < nThreadsToUse; ++t) {
-                workers.emplace_back([this, t, nThreadsToUse, nChunks, &aoMissingChunks, pMegaBuffer, &apData, nMinOffset, nExpectedBytes, bIsMegaFetch, nBlockXOff, nBlockYOff, &aoOutputs, &bSuccess]() {
+                workers.emplace_back([this, t, nThreadsToUse, nPlanned, &aoBlocks, &aoMissingChunks, &anRangeIdx, pMegaBuffer, pMappedBase, &apData, &aoUringRequests, &poUringLatch, nMinOffset, bIsMegaFetch, nBlockXOff, nBlockYOff, pImage, &aoOutputs, &bSuccess]() {
                     
-                    for (int i = t; i < nChunks; i += nThreadsToUse) {
-                        auto& chunk = aoMissingChunks[i];
-                        auto& outChunk = aoOutputs[i];
-
-                        outChunk.nBlockX = chunk.nBlockX;
-                        outChunk.nBlockY = chunk.nBlockY;
-                        outChunk.bIsMissing = chunk.bIsMissing;
-                        outChunk.bIsTarget = (chunk.nBlockX == nBlockXOff && chunk.nBlockY == nBlockYOff);
+                    for (int b = t; b < nPlanned; b += nThreadsToUse) {
+                        const auto& block = aoBlocks[b];
+                        auto& outBlock = aoOutputs[b];
+
+                        outBlock.bIsTarget = (block.poBand == this && block.nBlockX == nBlockXOff && block.nBlockY == nBlockYOff);
                         
-                        // Allocate dedicated memory array isolated inside this specific worker thread
-                        outChunk.osData.resize(nExpectedBytes);
+                        // Mapped target blocks skip the staging buffer entirely
+                        outBlock.bDecodedInPlace = pMappedBase && outBlock.bIsTarget;
+
+                        // Allocate dedicated memory array isolated inside this specific worker thread;
+                        // co-fetched mask and term blocks have their own sample size
+                        const size_t nExpectedBytes = static_cast<size_t>(nBlockXSize) * nBlockYSize *
+                                                      GDALGetDataTypeSizeBytes(block.poBand->eDataType);
+                        if (!outBlock.bDecodedInPlace) outBlock.osData.resize(nExpectedBytes);
+                        GByte* pabyDst = outBlock.bDecodedInPlace ? static_cast<GByte*>(pImage) : outBlock.osData.data();
+
+                        bool bBlockOK = true;
+                        for (size_t i = block.iFirstChunk; bBlockOK && i < block.iEndChunk; i++) {
+                            const auto& chunk = aoMissingChunks[i];
+                            const int iRange = anRangeIdx[i];
 
-                        if (chunk.bIsMissing) {
-                            memset(outChunk.osData.data(), 0, nExpectedBytes);
-                            outChunk.bValid = true;
-                        } else {
                             const GByte* pSrcBytes = nullptr;
-                            if (bIsMegaFetch) {
+                            if (chunk.bIsConstant) {
+                                block.poBand->FillChunkInBlock(chunk.nBlockX, chunk.nBlockY, chunk.abyConstant, pabyDst);
+                                continue;
+                            } else if (chunk.bIsMissing) {
+                                // Sparse chunk: fill value over its part of the block
+                            } else if (poUringLatch) {
+                                if (!poUringLatch->Wait(iRange)) {
+                                    if (outBlock.bIsTarget) bSuccess = false;
+                                    bBlockOK = false;
+                                    continue;
+                                }
+                                pSrcBytes = aoUringRequests[iRange].pabyData;
+                            } else if (pMappedBase) {
+                                pSrcBytes = pMappedBase + chunk.nOffset;
+                            } else if (bIsMegaFetch) {
                                 size_t nChunkOffsetInBuffer = static_cast<size_t>(chunk.nOffset - nMinOffset);
                                 pSrcBytes = static_cast<const GByte*>(pMegaBuffer) + nChunkOffsetInBuffer;
                             } else {
-                                size_t validIdx = 0;
-                                for(int k = 0; k < i; ++k) if(!aoMissingChunks[k].bIsMissing) validIdx++;
-                                pSrcBytes = static_cast<const GByte*>(apData[validIdx]);
+                                pSrcBytes = static_cast<const GByte*>(apData[iRange]);
+                                // Neighbour dropped at the read deadline: leave it uncached
+                                if (pSrcBytes == nullptr) { bBlockOK = false; continue; }
                             }
                             
                             // Safe SIMD Decompression executes completely in isolated thread memory spaces
-                            bool bProcessSuccess = ProcessAndCopyChunk(pSrcBytes, chunk.nLength, outChunk.osData.data());
-                            if (bProcessSuccess) {
-                                outChunk.bValid = true;
-                            } else {
-                                memset(outChunk.osData.data(), 0, nExpectedBytes);
-                                bSuccess = false; 
+                            if (!block.poBand->DecodeChunkIntoBlock(pSrcBytes, chunk.nLength, chunk.nFilterMask, chunk.nBlockX, chunk.nBlockY, pabyDst)) {
+                                memset(pabyDst, 0, nExpectedBytes);
+                                if (outBlock.bIsTarget) bSuccess = false;
+                                bBlockOK = false;
                             }
                         }
+                        outBlock.bValid = bBlockOK;
                     }
                 });
             }
@@ -986,27 +2459,43 @@ CPLErr NisarRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
             for (auto& worker : workers) {
                 if (worker.joinable()) worker.join();
             }
+            if (oUringReaper.joinable()) oUringReaper.join();
+
+            // APPLY_MASK: invalid pixels take the nodata value before any cache sees them
+            for (int b = 0; b < nPlanned; ++b) {
+                auto& outBlock = aoOutputs[b];
+                const auto& block = aoBlocks[b];
+                if (!outBlock.bValid || !block.poBand->m_bApplyMask) continue;
+                const GByte* pabyMask = (block.iMaskBlock >= 0 && aoOutputs[block.iMaskBlock].bValid)
+                                            ? aoOutputs[block.iMaskBlock].osData.data() : nullptr;
+                GByte* pabyData = outBlock.bDecodedInPlace ? static_cast<GByte*>(pImage) : outBlock.osData.data();
+                if (!block.poBand->ApplyLayerMask(block.nBlockX, block.nBlockY, pabyData, pabyMask)) {
+                    if (outBlock.bIsTarget) bSuccess = false;
+                    outBlock.bValid = false;
+                }
+            }
 
             // SAFE SINGLE-THREADED INJECTION INTO GDAL BLOCK CACHE
             // Running this on the main thread guarantees complete thread safety for GDAL
-            for (int i = 0; i < nChunks; ++i) {
-                auto& outChunk = aoOutputs[i];
-                if (!outChunk.bValid) continue;
+            for (int b = 0; b < nPlanned; ++b) {
+                auto& outBlock = aoOutputs[b];
+                if (!outBlock.bValid || aoBlocks[b].bFusedMask) continue;
 
-                if (outChunk.bIsTarget) {
+                if (outBlock.bIsTarget) {
                     // Direct delivery to GDAL application buffer
-                    memcpy(pImage, outChunk.osData.data(), nExpectedBytes);
+                    if (!outBlock.bDecodedInPlace) memcpy(pImage, outBlock.osData.data(), outBlock.osData.size());
                 } else {
                     // Neighborhood blocks are safely integrated into the cache sequentially
-                    GDALRasterBlock* poBlock = GetLockedBlockRef(outChunk.nBlockX, outChunk.nBlockY, 1);
+                    GDALRasterBlock* poBlock = aoBlocks[b].poBand->GetLockedBlockRef(aoBlocks[b].nBlockX, aoBlocks[b].nBlockY, 1);
                     if (poBlock) {
-                        memcpy(poBlock->GetDataRef(), outChunk.osData.data(), nExpectedBytes);
+                        memcpy(poBlock->GetDataRef(), outBlock.osData.data(), outBlock.osData.size());
                         poBlock->DropLock();
                     }
                 }
             }
 
             // Clean up original download memory allocations safely
+            NisarLocalIO::FreeRequests(aoUringRequests);
             if (bIsMegaFetch) {
                 CPLFree(pMegaBuffer);
             } else {
@@ -1017,50 +2506,677 @@ CPLErr NisarRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
         }
     }
     
-    memset(pImage, 0, static_cast<size_t>(nBlockXSize) * nBlockYSize * GDALGetDataTypeSizeBytes(eDataType));
+    // Nothing to fetch for this block: its chunks are sparse or constant.
+    // The plan holds copies of them, so the index lock is not needed for
+    // the fill, nor held across the mask read of ApplyLayerMask
+    if (oLock.owns_lock()) oLock.unlock();
+    for (const auto& block : aoBlocks) {
+        if (block.poBand != this || block.nBlockX != nBlockXOff || block.nBlockY != nBlockYOff) continue;
+        for (size_t i = block.iFirstChunk; i < block.iEndChunk; i++) {
+            const auto& chunk = aoMissingChunks[i];
+            FillChunkInBlock(chunk.nBlockX, chunk.nBlockY, chunk.bIsConstant ? chunk.abyConstant : nullptr,
+                             static_cast<GByte*>(pImage));
+        }
+    }
+    if (!ApplyLayerMask(nBlockXOff, nBlockYOff, static_cast<GByte*>(pImage))) return CE_Failure;
     return CE_None;
 }
-// ====================================================================
-// NisarHDF5MaskBand Implementation
-// ====================================================================
-
-NisarHDF5MaskBand::NisarHDF5MaskBand(NisarDataset* poDSIn, hid_t hMaskDS, NisarMaskType eType) :
-    m_hMaskDS(hMaskDS),
-    m_hMaskFileSpaceID(-1),
-    m_eType(eType)
+/***************************************************************************/
+/*                        ReadBlocksThroughHDF5()                          */
+/* Fallback for filter pipelines without a native decoder (N-bit,          */
+/* scale-offset, LZF, Blosc, ...). H5Dread_chunk only returns the filtered */
+/* bytes, so each planned block is read as a hyperslab and HDF5 applies    */
+/* its filter stack. The whole batch runs under one library lock; the      */
+/* neighbours are then injected into the block cache like the direct path. */
+/***************************************************************************/
+CPLErr NisarRasterBand::ReadBlocksThroughHDF5(const std::vector<std::pair<int, int>>& aoBlocks,
+                                              int nBlockXOff, int nBlockYOff, void* pImage)
 {
-    this->poDS = poDSIn;
-    this->nBand = 0; // Mask bands usually have nBand=0
-    this->eDataType = GDT_Byte;
- 
-    // CACHE THE DATASPACE ONCE
-    if (m_hMaskDS >= 0)
+    static std::mutex oHDF5Mutex;
+
+    const hid_t hDatasetID = m_hDataset;
+    const int rank = (m_hFileSpaceID >= 0) ? H5Sget_simple_extent_ndims(m_hFileSpaceID) : -1;
+    if (hDatasetID < 0 || rank < 2) return CE_Failure;
+
+    const size_t nBlockPixels = static_cast<size_t>(nBlockXSize) * nBlockYSize;
+    const size_t nBlockBytes = nBlockPixels * GDALGetDataTypeSizeBytes(eDataType);
+    const size_t nStoredBytes = nBlockPixels * GDALGetDataTypeSizeBytes(m_eStorageType);
+    std::vector<std::vector<GByte>> aabyBlocks(aoBlocks.size());
+    std::vector<bool> abOK(aoBlocks.size(), false);
+
+    auto t_start = std::chrono::high_resolution_clock::now();
     {
-        m_hMaskFileSpaceID = H5Dget_space(m_hMaskDS);
+        std::lock_guard<std::mutex> oLock(oHDF5Mutex);
+        const hid_t hMemType = H5Tget_native_type(hH5Type, H5T_DIR_ASCEND);
+        for (size_t b = 0; b < aoBlocks.size(); b++) {
+            const int nX0 = aoBlocks[b].first * nBlockXSize;
+            const int nY0 = aoBlocks[b].second * nBlockYSize;
+            const int nRequestX = std::min(nBlockXSize, nRasterXSize - nX0);
+            const int nRequestY = std::min(nBlockYSize, nRasterYSize - nY0);
+
+            std::vector<hsize_t> offset(rank, 0), count(rank, 1);
+            if (rank == 3) offset[0] = static_cast<hsize_t>(m_iSlice);
+            offset[rank - 2] = static_cast<hsize_t>(nY0);
+            offset[rank - 1] = static_cast<hsize_t>(nX0);
+            count[rank - 2] = static_cast<hsize_t>(nRequestY);
+            count[rank - 1] = static_cast<hsize_t>(nRequestX);
+
+            hid_t hFileSpace = H5Scopy(m_hFileSpaceID);
+            H5Sselect_hyperslab(hFileSpace, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+
+            // Partial edge blocks land in the top-left of the full block
+            hsize_t mem_dims[2] = { static_cast<hsize_t>(nBlockYSize), static_cast<hsize_t>(nBlockXSize) };
+            hsize_t mem_start[2] = {0, 0};
+            hsize_t mem_count[2] = { static_cast<hsize_t>(nRequestY), static_cast<hsize_t>(nRequestX) };
+            hid_t hMemSpace = H5Screate_simple(2, mem_dims, nullptr);
+            H5Sselect_hyperslab(hMemSpace, H5S_SELECT_SET, mem_start, nullptr, mem_count, nullptr);
+
+            aabyBlocks[b].assign(nStoredBytes, 0);
+            abOK[b] = H5Dread(hDatasetID, hMemType, hMemSpace, hFileSpace,
+                              NisarVFL::HDF5VFLGetVectorDXPL(), aabyBlocks[b].data()) >= 0;
+
+            H5Sclose(hMemSpace);
+            H5Sclose(hFileSpace);
+        }
+        if (hMemType >= 0) H5Tclose(hMemType);
+    }
+    std::chrono::duration<double, std::milli> t_diff = std::chrono::high_resolution_clock::now() - t_start;
+    CPLDebug("NISAR_NET_PERF", "[HDF5-FILTER] Blocks: %zu | Pipeline: %s | Time: %.3f ms",
+             aoBlocks.size(), m_oFilters.Describe().c_str(), t_diff.count());
+
+    bool bTargetOK = false;
+    std::vector<GByte> abyDerived(m_eDerived != NisarDerived::Kind::None ? nBlockBytes : 0);
+    for (size_t b = 0; b < aoBlocks.size(); b++) {
+        if (!abOK[b]) continue;
+        if (m_bIsMask) ApplyMaskLUT(m_eMaskType, aabyBlocks[b].data(), nBlockPixels);
+        if (!abyDerived.empty()) {
+            NisarDerived::Apply(m_eDerived, m_bDerivedFast, aabyBlocks[b].data(), m_eStorageType, nBlockPixels,
+                                reinterpret_cast<float*>(abyDerived.data()));
+            aabyBlocks[b].swap(abyDerived);
+        }
+        if (!ApplyLayerMask(aoBlocks[b].first, aoBlocks[b].second, aabyBlocks[b].data())) continue;
+        if (aoBlocks[b].first == nBlockXOff && aoBlocks[b].second == nBlockYOff) {
+            memcpy(pImage, aabyBlocks[b].data(), nBlockBytes);
+            bTargetOK = true;
+            continue;
+        }
+        GDALRasterBlock* poBlock = GetLockedBlockRef(aoBlocks[b].first, aoBlocks[b].second, 1);
+        if (poBlock) {
+            memcpy(poBlock->GetDataRef(), aabyBlocks[b].data(), nBlockBytes);
+            poBlock->DropLock();
+        }
+    }
+    if (!bTargetOK) {
+        CPLError(CE_Failure, CPLE_FileIO, "NISAR: HDF5 read of block (%d, %d) failed.", nBlockXOff, nBlockYOff);
+        return CE_Failure;
     }
+    return CE_None;
+}
 
-    // Copy dimensions/blocking from the parent dataset
-    this->nRasterXSize = poDSIn->GetRasterXSize();
-    this->nRasterYSize = poDSIn->GetRasterYSize();
-    
-    // Get chunk size from HDF5 to optimize I/O
-    hid_t hDAPL = H5Dget_create_plist(m_hMaskDS);
-    if (H5Pget_layout(hDAPL) == H5D_CHUNKED) {
-        hsize_t chunk_dims[2];
-        H5Pget_chunk(hDAPL, 2, chunk_dims);
-        this->nBlockXSize = static_cast<int>(chunk_dims[1]); // X is last dim
-        this->nBlockYSize = static_cast<int>(chunk_dims[0]);
-    } else {
-        // Fallback if not chunked (unlikely for L2)
-        this->nBlockXSize = this->nRasterXSize;
-        this->nBlockYSize = 1;
+/***************************************************************************/
+/*                          GetChunkForWindow()                            */
+/* The stored chunk whose extent (clipped to the raster) is exactly the    */
+/* window, or nullptr. Chunks written with a skipped filter do not qualify */
+/* since their bytes are not in the advertised format.                     */
+/***************************************************************************/
+const NisarRasterBand::NisarChunkInfo* NisarRasterBand::GetChunkForWindow(int nXOff, int nYOff,
+                                                                         int nXSize, int nYSize) const
+{
+    if (m_bRawLayout || m_nChunkXSize <= 0 || m_nChunkYSize <= 0) return nullptr;
+    if (nXOff % m_nChunkXSize != 0 || nYOff % m_nChunkYSize != 0) return nullptr;
+    if (nXSize != std::min(m_nChunkXSize, nRasterXSize - nXOff) ||
+        nYSize != std::min(m_nChunkYSize, nRasterYSize - nYOff)) return nullptr;
+
+    const size_t idx = static_cast<size_t>(nYOff / m_nChunkYSize) * m_nChunksPerRow + nXOff / m_nChunkXSize;
+    if (idx >= m_aoAllChunks.size()) return nullptr;
+    const NisarChunkInfo& chunk = m_aoAllChunks[idx];
+    if (chunk.bIsMissing || chunk.nFilterMask != 0) return nullptr;
+    return &chunk;
+}
+
+/***************************************************************************/
+/*                       GetCompressedChunkFormat()                        */
+/* Detailed GDAL compression format of this band's stored chunks, e.g.     */
+/* "DEFLATE;data_type=Float32;shuffle=YES;...", or "" if the pipeline has  */
+/* no single codec a consumer could decode.                                */
+/***************************************************************************/
+std::string NisarRasterBand::GetCompressedChunkFormat() const
+{
+    // Stored chunks are complex; a DERIVED band serves Float32. Under
+    // APPLY_MASK they lack the mask blend
+    if (!m_oFilters.IsNative() || m_eDerived != NisarDerived::Kind::None || m_bApplyMask) return std::string();
+
+    const char* pszCodec = nullptr;
+    int nLevel = -1;
+    for (const auto& oStep : m_oFilters.GetSteps()) {
+        if (oStep.nId == H5Z_FILTER_DEFLATE) {
+            pszCodec = "DEFLATE";
+            nLevel = m_nDeflateLevel;
+        } else if (oStep.nId == NisarFilters::NISAR_H5Z_FILTER_ZSTD) {
+            pszCodec = "ZSTD";
+        }
+    }
+    if (!pszCodec) return std::string();
+
+#if CPL_IS_LSB
+    const bool bFileLittleEndian = !m_bNeedsEndianSwap;
+#else
+    const bool bFileLittleEndian = m_bNeedsEndianSwap;
+#endif
+    std::string osFormat = CPLSPrintf("%s;data_type=%s;endianness=%s;shuffle=%s;block_xsize=%d;block_ysize=%d",
+                                      pszCodec, GDALGetDataTypeName(m_eStorageType),
+                                      bFileLittleEndian ? "LITTLE" : "BIG",
+                                      m_oFilters.HasShuffle() ? "YES" : "NO",
+                                      m_nChunkXSize, m_nChunkYSize);
+    if (nLevel >= 0) osFormat += CPLSPrintf(";level=%d", nLevel);
+    return osFormat;
+}
+
+/***************************************************************************/
+/*                        IsFileOrderScanWindow()                          */
+/* A multi-block, non-resampled window is streamed in file-offset order    */
+/* when SCAN_ORDER=FILE_OFFSET, or under AUTO when it covers whole block   */
+/* rows of the full raster width (whole-layer reads and                    */
+/* GDALDatasetCopyWholeRaster swaths). Line-by-line readers stay on the    */
+/* block cache so each chunk row is decoded once.                          */
+/***************************************************************************/
+bool NisarRasterBand::IsFileOrderScanWindow(int nXOff, int nYOff, int nXSize, int nYSize) const
+{
+    // APPLY_MASK blends each block with its mask in IReadBlock
+    if (m_aoAllChunks.empty() || !m_oFilters.IsNative() || m_bApplyMask || nXSize <= 0 || nYSize <= 0) return false;
+
+    const char* pszOrder = static_cast<NisarDataset*>(poDS)->m_sScanOrder.c_str();
+    if (EQUAL(pszOrder, "ROW_MAJOR")) return false;
+
+    const int nBlocksX = (nXOff + nXSize - 1) / nBlockXSize - nXOff / nBlockXSize + 1;
+    const int nBlocksY = (nYOff + nYSize - 1) / nBlockYSize - nYOff / nBlockYSize + 1;
+    if (static_cast<GIntBig>(nBlocksX) * nBlocksY < 2) return false;
+
+    if (EQUAL(pszOrder, "FILE_OFFSET")) return true;
+    if (nXOff != 0 || nXSize != nRasterXSize || nYOff % nBlockYSize != 0) return false;
+    return nYSize % nBlockYSize == 0 || nYOff + nYSize == nRasterYSize;
+}
+
+/***************************************************************************/
+/*                         GetDecodeThreadCount()                          */
+/* Decode workers of a file-order scan: GDAL_NUM_THREADS, else the cores.  */
+/***************************************************************************/
+static int GetDecodeThreadCount()
+{
+    int nNumThreads = std::thread::hardware_concurrency();
+    if (nNumThreads <= 0) nNumThreads = 4;
+    const char* pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads && !EQUAL(pszNumThreads, "ALL_CPUS")) {
+        nNumThreads = std::max(1, atoi(pszNumThreads));
+    }
+    return nNumThreads;
+}
+
+/***************************************************************************/
+/*                           ScanInFileOrder()                             */
+/* Sorts the window's chunks by file offset, groups neighbours into large  */
+/* sequential ranges (NISAR_SCAN_RANGE_BYTES, gaps up to                   */
+/* NISAR_SCAN_GAP_BYTES) and streams them with one read per group. The     */
+/* next group is fetched while the current one is decoded. Decoded chunks  */
+/* are scattered straight into pData, injected into the block cache when  */
+/* bFillCache is set (AdviseRead), or passed to pfnVisitor (statistics).   */
+/***************************************************************************/
+CPLErr NisarRasterBand::ScanInFileOrder(int nXOff, int nYOff, int nXSize, int nYSize,
+                                        void* pData, GDALDataType eBufType,
+                                        GSpacing nPixelSpace, GSpacing nLineSpace,
+                                        bool bFillCache, const ChunkVisitor* pfnVisitor,
+                                        GDALProgressFunc pfnProgress, void* pProgressData)
+{
+    const int nBX0 = nXOff / nBlockXSize, nBX1 = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBY0 = nYOff / nBlockYSize, nBY1 = (nYOff + nYSize - 1) / nBlockYSize;
+    const int nMultX = nBlockXSize / m_nChunkXSize;
+    const int nMultY = nBlockYSize / m_nChunkYSize;
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const size_t nBlockBytes = static_cast<size_t>(nBlockXSize) * nBlockYSize * nDTSize;
+    const size_t nChunkBytes = static_cast<size_t>(m_nChunkXSize) * m_nChunkYSize * nDTSize;
+
+    // Copies the window overlap of one decoded chunk into the caller buffer,
+    // or hands it to the visitor
+    auto Scatter = [&](int nCX, int nCY, const GByte* pabyChunk, int iWorker) {
+        const int nX0 = std::max(nXOff, nCX * m_nChunkXSize);
+        const int nX1 = std::min(nXOff + nXSize, (nCX + 1) * m_nChunkXSize);
+        const int nY0 = std::max(nYOff, nCY * m_nChunkYSize);
+        const int nY1 = std::min(nYOff + nYSize, (nCY + 1) * m_nChunkYSize);
+        if (pfnVisitor) {
+            if (nX1 > nX0 && nY1 > nY0) {
+                (*pfnVisitor)(iWorker, pabyChunk + (static_cast<size_t>(nY0 - nCY * m_nChunkYSize) * m_nChunkXSize +
+                                                    (nX0 - nCX * m_nChunkXSize)) * nDTSize,
+                              nX1 - nX0, nY1 - nY0, static_cast<size_t>(m_nChunkXSize));
+            }
+            return;
+        }
+        for (int y = nY0; y < nY1; y++) {
+            const GByte* pSrc = pabyChunk +
+                (static_cast<size_t>(y - nCY * m_nChunkYSize) * m_nChunkXSize + (nX0 - nCX * m_nChunkXSize)) * nDTSize;
+            GByte* pDst = static_cast<GByte*>(pData) + (y - nYOff) * nLineSpace + (nX0 - nXOff) * nPixelSpace;
+            GDALCopyWords64(pSrc, eDataType, nDTSize, pDst, eBufType, static_cast<int>(nPixelSpace), nX1 - nX0);
+        }
+    };
+
+    // Cache fill: blocks are assembled chunk by chunk and injected once complete
+    struct PendingBlock { std::vector<GByte> abyData; int nRemaining = 0; };
+    std::map<std::pair<int, int>, PendingBlock> oPending;
+
+    // 1. Collect the window's chunks; sparse chunks read as the fill value like IReadBlock,
+    // constant chunks as their replicated pixel
+    std::vector<NisarChunkInfo> aoScan;
+    std::vector<GByte> abyFill;
+    std::vector<NisarChunkInfo> aoConstant;
+    std::unique_lock<std::mutex> oIndexLock(m_oMegaFetchMutex);
+    for (int nBY = nBY0; nBY <= nBY1; nBY++) {
+        for (int nBX = nBX0; nBX <= nBX1; nBX++) {
+            if (bFillCache) {
+                GDALRasterBlock* poBlock = TryGetLockedBlockRef(nBX, nBY);
+                if (poBlock) { poBlock->DropLock(); continue; }
+            }
+            int nPresent = 0;
+            aoConstant.clear();
+            for (int nCY = nBY * nMultY; nCY < (nBY + 1) * nMultY; nCY++) {
+                for (int nCX = nBX * nMultX; nCX < (nBX + 1) * nMultX; nCX++) {
+                    const size_t idx = static_cast<size_t>(nCY) * m_nChunksPerRow + nCX;
+                    if (nCX < m_nChunksPerRow && nCY < m_nChunksPerCol &&
+                        idx < m_aoAllChunks.size() && m_aoAllChunks[idx].bIsConstant) {
+                        aoConstant.push_back(m_aoAllChunks[idx]);
+                        aoConstant.back().nBlockX = nCX;
+                        aoConstant.back().nBlockY = nCY;
+                        if (!bFillCache) {
+                            std::vector<GByte> abyConstant(nChunkBytes);
+                            FillPixels(abyConstant.data(), static_cast<size_t>(m_nChunkXSize) * m_nChunkYSize,
+                                       aoConstant.back().abyConstant);
+                            Scatter(nCX, nCY, abyConstant.data(), 0);
+                        }
+                    } else if (nCX < m_nChunksPerRow && nCY < m_nChunksPerCol &&
+                        idx < m_aoAllChunks.size() && !m_aoAllChunks[idx].bIsMissing) {
+                        aoScan.push_back(m_aoAllChunks[idx]);
+                        nPresent++;
+                    } else if (!bFillCache && nCX < m_nChunksPerRow && nCY < m_nChunksPerCol) {
+                        if (abyFill.empty()) {
+                            abyFill.resize(nChunkBytes);
+                            FillPixels(abyFill.data(), static_cast<size_t>(m_nChunkXSize) * m_nChunkYSize);
+                        }
+                        Scatter(nCX, nCY, abyFill.data(), 0);
+                    }
+                }
+            }
+            if (bFillCache && (nPresent > 0 || !aoConstant.empty())) {
+                PendingBlock& oBlock = oPending[std::make_pair(nBX, nBY)];
+                oBlock.abyData.resize(nBlockBytes);
+                FillPixels(oBlock.abyData.data(), static_cast<size_t>(nBlockXSize) * nBlockYSize);
+                for (const auto& chunk : aoConstant)
+                    FillChunkInBlock(chunk.nBlockX, chunk.nBlockY, chunk.abyConstant, oBlock.abyData.data());
+                oBlock.nRemaining = nPresent;
+            }
+        }
+    }
+    oIndexLock.unlock();
+
+    // Blocks made only of constant (and sparse) chunks are complete already
+    for (auto oIter = oPending.begin(); oIter != oPending.end();) {
+        if (oIter->second.nRemaining > 0) { ++oIter; continue; }
+        GDALRasterBlock* poBlock = GetLockedBlockRef(oIter->first.first, oIter->first.second, TRUE);
+        if (poBlock) {
+            memcpy(poBlock->GetDataRef(), oIter->second.abyData.data(), nBlockBytes);
+            poBlock->DropLock();
+        }
+        oIter = oPending.erase(oIter);
+    }
+    if (aoScan.empty()) return CE_None;
+
+    // 2. File-offset order, grouped into large sequential ranges
+    std::sort(aoScan.begin(), aoScan.end(),
+              [](const NisarChunkInfo& a, const NisarChunkInfo& b) { return a.nOffset < b.nOffset; });
+
+    const size_t nMaxRange = static_cast<size_t>(std::max(1LL, atoll(CPLGetConfigOption("NISAR_SCAN_RANGE_BYTES", "67108864"))));
+    const size_t nMaxGap = static_cast<size_t>(std::max(0LL, atoll(CPLGetConfigOption("NISAR_SCAN_GAP_BYTES", "1048576"))));
+
+    struct ScanGroup { size_t iFirst; size_t iEnd; vsi_l_offset nStart; size_t nSpan; };
+    std::vector<ScanGroup> aoGroups;
+    for (size_t i = 0; i < aoScan.size(); i++) {
+        const vsi_l_offset nChunkEnd = aoScan[i].nOffset + aoScan[i].nLength;
+        if (!aoGroups.empty()) {
+            ScanGroup& g = aoGroups.back();
+            const vsi_l_offset nGroupEnd = g.nStart + g.nSpan;
+            if (aoScan[i].nOffset <= nGroupEnd + nMaxGap && nChunkEnd - g.nStart <= nMaxRange) {
+                g.iEnd = i + 1;
+                g.nSpan = static_cast<size_t>(std::max(nGroupEnd, nChunkEnd) - g.nStart);
+                continue;
+            }
+        }
+        aoGroups.push_back({i, i + 1, aoScan[i].nOffset, aoScan[i].nLength});
+    }
+
+    // 3. Source: the local mapping when available, io_uring when asked for
+    //    (NISAR_USE_IO_URING), else ranged reads
+    const std::string sRawPath = GetRawVSIPath();
+    auto poNisarDS = static_cast<NisarDataset*>(poDS);
+    const bool bCompact = !m_abyCompactData.empty();
+    const bool bUseIOUring = !bCompact && !STARTS_WITH_CI(sRawPath.c_str(), "/vsi") &&
+                             CPLTestBool(CPLGetConfigOption("NISAR_USE_IO_URING", "NO")) &&
+                             NisarLocalIO::IsIOUringAvailable();
+    size_t nMapSize = bCompact ? m_abyCompactData.size() : 0;
+    const GByte* pMappedBase = bCompact ? m_abyCompactData.data() : bUseIOUring ? nullptr :
+        poNisarDS->GetMappedFile(sRawPath, &nMapSize);
+    if (pMappedBase) {
+        for (const auto& g : aoGroups) {
+            if (g.nStart + g.nSpan > nMapSize) { pMappedBase = nullptr; break; }
+        }
+    }
+
+    const size_t nPartSize = static_cast<size_t>(atoll(CPLGetConfigOption("NISAR_FETCH_PART_SIZE", "8388608")));
+    const int nFetchConcurrency = atoi(CPLGetConfigOption("NISAR_FETCH_CONCURRENCY", "8"));
+    const int nQueueDepth = atoi(CPLGetConfigOption("NISAR_IO_URING_QUEUE_DEPTH", "64"));
+    const bool bDirect = CPLTestBool(CPLGetConfigOption("NISAR_IO_URING_DIRECT", "NO"));
+    auto FetchGroup = [&](const ScanGroup& g, std::vector<GByte>& abyBuf) -> bool {
+        abyBuf.resize(g.nSpan);
+        if (bUseIOUring) {
+            // The group as NISAR_FETCH_PART_SIZE reads, all in flight at once
+            const size_t nPart = nPartSize > 0 ? nPartSize : g.nSpan;
+            std::vector<NisarLocalIO::LocalReadRequest> aoRequests((g.nSpan + nPart - 1) / nPart);
+            for (size_t i = 0; i < aoRequests.size(); i++) {
+                aoRequests[i].nOffset = g.nStart + i * nPart;
+                aoRequests[i].nSize = std::min(nPart, g.nSpan - i * nPart);
+            }
+            const bool bOK = NisarLocalIO::ReadBatchIOUring(sRawPath, aoRequests, nQueueDepth, bDirect,
+                                                            [](size_t, bool) {});
+            for (size_t i = 0; bOK && i < aoRequests.size(); i++) {
+                memcpy(abyBuf.data() + i * nPart, aoRequests[i].pabyData, aoRequests[i].nSize);
+            }
+            NisarLocalIO::FreeRequests(aoRequests);
+            return bOK;
+        }
+        if (nPartSize > 0 && nFetchConcurrency > 1 && g.nSpan > nPartSize) {
+            return ReadSpanParallel(sRawPath, g.nStart, g.nSpan, abyBuf.data(), nPartSize, nFetchConcurrency);
+        }
+        VSILFILE* fp = VSIFOpenL(sRawPath.c_str(), "rb");
+        if (!fp) return false;
+        const bool bOK = VSIFSeekL(fp, g.nStart, SEEK_SET) == 0 && VSIFReadL(abyBuf.data(), 1, g.nSpan, fp) == g.nSpan;
+        VSIFCloseL(fp);
+        return bOK;
+    };
+
+    const int nNumThreads = GetDecodeThreadCount();
+
+    auto scan_start_time = std::chrono::high_resolution_clock::now();
+    size_t nTotalBytes = 0;
+
+    std::vector<GByte> abyCur, abyNext;
+    bool bCurOK = pMappedBase ? true : FetchGroup(aoGroups[0], abyCur);
+    std::atomic<bool> bSuccess{true};
+
+    for (size_t iGroup = 0; iGroup < aoGroups.size(); iGroup++) {
+        const ScanGroup& g = aoGroups[iGroup];
+        if (!bCurOK) {
+            CPLError(CE_Failure, CPLE_FileIO, "NISAR: Sequential scan read of %zu bytes at offset " CPL_FRMT_GUIB " failed.",
+                     g.nSpan, static_cast<GUIntBig>(g.nStart));
+            return CE_Failure;
+        }
+
+        // Overlap: fetch (or page in) the next group while this one decodes
+        bool bNextOK = true;
+        std::thread oPrefetch;
+        if (iGroup + 1 < aoGroups.size()) {
+            const ScanGroup& gNext = aoGroups[iGroup + 1];
+            if (pMappedBase) {
+                if (!bCompact) poNisarDS->AdviseMappedRange(gNext.nStart, gNext.nSpan);
+            } else {
+                oPrefetch = std::thread([&FetchGroup, &gNext, &abyNext, &bNextOK]() {
+                    bNextOK = FetchGroup(gNext, abyNext);
+                });
+            }
+        }
+
+        const GByte* pGroupBase = pMappedBase ? pMappedBase + g.nStart : abyCur.data();
+        const size_t nChunks = g.iEnd - g.iFirst;
+        std::atomic<size_t> nNextChunk{0};
+
+        auto DecodeWorker = [&](int iWorker) {
+            std::vector<GByte> abyChunk(bFillCache ? 0 : nChunkBytes);
+            for (size_t k = nNextChunk++; k < nChunks; k = nNextChunk++) {
+                const NisarChunkInfo& chunk = aoScan[g.iFirst + k];
+                const GByte* pSrc = pGroupBase + (chunk.nOffset - g.nStart);
+                if (bFillCache) {
+                    // Chunks of one block decode into disjoint sub-rectangles
+                    PendingBlock& oBlock = oPending.find(std::make_pair(chunk.nBlockX / nMultX, chunk.nBlockY / nMultY))->second;
+                    if (!DecodeChunkIntoBlock(pSrc, chunk.nLength, chunk.nFilterMask, chunk.nBlockX, chunk.nBlockY, oBlock.abyData.data())) {
+                        DecodeChunkIntoBlock(nullptr, 0, 0, chunk.nBlockX, chunk.nBlockY, oBlock.abyData.data());
+                        bSuccess = false;
+                    }
+                    continue;
+                }
+                if (!ProcessAndCopyChunk(pSrc, chunk.nLength, chunk.nFilterMask, abyChunk.data())) {
+                    memset(abyChunk.data(), 0, nChunkBytes);
+                    bSuccess = false;
+                }
+                Scatter(chunk.nBlockX, chunk.nBlockY, abyChunk.data(), iWorker);
+            }
+        };
+
+        const int nThreadsToUse = static_cast<int>(std::min<size_t>(nNumThreads, nChunks));
+        std::vector<std::thread> workers;
+        for (int t = 1; t < nThreadsToUse; t++) workers.emplace_back(DecodeWorker, t);
+        DecodeWorker(0);
+        for (auto& worker : workers) worker.join();
+
+        // Cache injection stays on the calling thread
+        if (bFillCache) {
+            for (size_t k = 0; k < nChunks; k++) {
+                const NisarChunkInfo& chunk = aoScan[g.iFirst + k];
+                auto oIter = oPending.find(std::make_pair(chunk.nBlockX / nMultX, chunk.nBlockY / nMultY));
+                if (oIter == oPending.end() || --oIter->second.nRemaining > 0) continue;
+                GDALRasterBlock* poBlock = GetLockedBlockRef(oIter->first.first, oIter->first.second, TRUE);
+                if (poBlock) {
+                    memcpy(poBlock->GetDataRef(), oIter->second.abyData.data(), nBlockBytes);
+                    poBlock->DropLock();
+                }
+                oPending.erase(oIter);
+            }
+        }
+
+        nTotalBytes += g.nSpan;
+        if (oPrefetch.joinable()) oPrefetch.join();
+        std::swap(abyCur, abyNext);
+        bCurOK = bNextOK;
+
+        if (pfnProgress && !pfnProgress(static_cast<double>(iGroup + 1) / aoGroups.size(), nullptr, pProgressData)) {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    std::chrono::duration<double, std::milli> scan_elapsed = std::chrono::high_resolution_clock::now() - scan_start_time;
+    const double dMegabytes = nTotalBytes / (1024.0 * 1024.0);
+    CPLDebug("NISAR_NET_PERF", "[FILE-ORDER ] Chunks: %zu | Ranges: %zu | Read: %.2f MB | Throughput: %.2f MB/s%s",
+             aoScan.size(), aoGroups.size(), dMegabytes, dMegabytes / std::max(scan_elapsed.count() / 1000.0, 1e-9),
+             pMappedBase ? " | mmap" : bUseIOUring ? " | io_uring" : "");
+
+    return bSuccess ? CE_None : CE_Failure;
+}
+
+/***************************************************************************/
+/*                              IRasterIO()                                */
+/***************************************************************************/
+CPLErr NisarRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+                                  void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+                                  GSpacing nPixelSpace, GSpacing nLineSpace,
+                                  GDALRasterIOExtraArg *psExtraArg)
+{
+    // APPLY_MASK over all-invalid mask chunks: the window is nodata, no block is read
+    if (eRWFlag == GF_Read && m_bApplyMask) {
+        m_poMaskBand->EnsureCoverageSummary();
+        if (GetAppliedMaskCoverage(nXOff, nYOff, nXSize, nYSize) == NisarMaskCoverage::AllInvalid) {
+            for (int iLine = 0; iLine < nBufYSize; iLine++) {
+                GDALCopyWords64(m_abyMaskedPixel.data(), eDataType, 0, static_cast<GByte*>(pData) + iLine * nLineSpace,
+                                eBufType, static_cast<int>(nPixelSpace), nBufXSize);
+            }
+            return CE_None;
+        }
+    }
+
+    if (eRWFlag == GF_Read && nBufXSize == nXSize && nBufYSize == nYSize &&
+        IsFileOrderScanWindow(nXOff, nYOff, nXSize, nYSize))
+    {
+        return ScanInFileOrder(nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                               nPixelSpace, nLineSpace, false, nullptr,
+                               psExtraArg ? psExtraArg->pfnProgress : nullptr,
+                               psExtraArg ? psExtraArg->pProgressData : nullptr);
     }
-    H5Pclose(hDAPL);
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData,
+                                        nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
 }
+
+/***************************************************************************/
+/*                              AdviseRead()                               */
+/* A scan-eligible window that fits in half the block cache is streamed    */
+/* in file order up front, so the row-major IReadBlock calls that follow   */
+/* are cache hits.                                                         */
+/***************************************************************************/
+CPLErr NisarRasterBand::AdviseRead(int nXOff, int nYOff, int nXSize, int nYSize,
+                                   int nBufXSize, int nBufYSize, GDALDataType eDT,
+                                   char **papszOptions)
+{
+    if (nBufXSize == nXSize && nBufYSize == nYSize &&
+        IsFileOrderScanWindow(nXOff, nYOff, nXSize, nYSize))
+    {
+        const GIntBig nBlocks =
+            static_cast<GIntBig>((nXOff + nXSize - 1) / nBlockXSize - nXOff / nBlockXSize + 1) *
+            ((nYOff + nYSize - 1) / nBlockYSize - nYOff / nBlockYSize + 1);
+        const GIntBig nBytes = nBlocks * nBlockXSize * nBlockYSize * GDALGetDataTypeSizeBytes(eDataType);
+        if (nBytes < GDALGetCacheMax64() / 2) {
+            ScanInFileOrder(nXOff, nYOff, nXSize, nYSize, nullptr, eDataType, 0, 0, true);
+        } else {
+            CPLDebug("NISAR_DRIVER", "AdviseRead: window (" CPL_FRMT_GIB " bytes) exceeds half the block cache; not prefetching.", nBytes);
+        }
+    }
+    return GDALPamRasterBand::AdviseRead(nXOff, nYOff, nXSize, nYSize, nBufXSize, nBufYSize, eDT, papszOptions);
+}
+
+/***************************************************************************/
+/*                        IGetDataCoverageStatus()                         */
+/* Answered from the chunk index: windows over never-allocated chunks are  */
+/* EMPTY (they read as the fill value), allocated ones are DATA. Chunks    */
+/* detected as constant at the fill value also count as EMPTY, and so do   */
+/* chunks under all-invalid mask chunks with APPLY_MASK.                   */
+/***************************************************************************/
+int NisarRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize, int nYSize,
+                                            int nMaskFlagStop, double* pdfDataPct)
+{
+    if (m_aoAllChunks.empty() || m_nChunkXSize <= 0 || m_nChunkYSize <= 0) {
+        if (pdfDataPct) *pdfDataPct = 100.0;
+        return GDAL_DATA_COVERAGE_STATUS_UNIMPLEMENTED | GDAL_DATA_COVERAGE_STATUS_DATA;
+    }
+
+    const int nCX0 = nXOff / m_nChunkXSize, nCX1 = (nXOff + nXSize - 1) / m_nChunkXSize;
+    const int nCY0 = nYOff / m_nChunkYSize, nCY1 = (nYOff + nYSize - 1) / m_nChunkYSize;
+    const size_t nDTSize = m_abyFillPixel.size();
+    if (m_bApplyMask) m_poMaskBand->EnsureCoverageSummary();
+
+    std::lock_guard<std::mutex> oLock(m_oMegaFetchMutex);
+    int nStatus = 0;
+    GIntBig nDataPixels = 0;
+    for (int nCY = nCY0; nCY <= nCY1; nCY++) {
+        const int nRows = std::min(nYOff + nYSize, (nCY + 1) * m_nChunkYSize) - std::max(nYOff, nCY * m_nChunkYSize);
+        for (int nCX = nCX0; nCX <= nCX1; nCX++) {
+            const size_t idx = static_cast<size_t>(nCY) * m_nChunksPerRow + nCX;
+            const bool bData = nCX < m_nChunksPerRow && idx < m_aoAllChunks.size() && !m_aoAllChunks[idx].bIsMissing &&
+                               !(m_aoAllChunks[idx].bIsConstant &&
+                                 memcmp(m_aoAllChunks[idx].abyConstant, m_abyFillPixel.data(), nDTSize) == 0) &&
+                               GetAppliedMaskCoverage(nCX * m_nChunkXSize, nCY * m_nChunkYSize, m_nChunkXSize,
+                                                      m_nChunkYSize) != NisarMaskCoverage::AllInvalid;
+            if (bData) {
+                const int nCols = std::min(nXOff + nXSize, (nCX + 1) * m_nChunkXSize) - std::max(nXOff, nCX * m_nChunkXSize);
+                nDataPixels += static_cast<GIntBig>(nRows) * nCols;
+                nStatus |= GDAL_DATA_COVERAGE_STATUS_DATA;
+            } else {
+                nStatus |= GDAL_DATA_COVERAGE_STATUS_EMPTY;
+            }
+            // Caller only needs to know whether this status occurs
+            if (nStatus & nMaskFlagStop) return nStatus;
+        }
+    }
+
+    if (pdfDataPct) *pdfDataPct = 100.0 * static_cast<double>(nDataPixels) / (static_cast<double>(nXSize) * nYSize);
+    return nStatus;
+}
+
 // --------------------------------------------------------------------
 // Statistics Overrides (Prevents Application from scanning the whole file)
 // --------------------------------------------------------------------
 
+// Exact statistics stream the native chunks; APPLY_MASK and HDF5-filtered
+// layers go through GDAL's block walk
+bool NisarRasterBand::CanStreamStatistics() const
+{
+    return !m_aoAllChunks.empty() && m_oFilters.IsNative() && !m_bApplyMask;
+}
+
+/***************************************************************************/
+/*                           StreamStatistics()                            */
+/* One file-order scan of the whole band. Each decode worker converts its  */
+/* chunk rows to doubles and folds them into its own Partial and/or        */
+/* histogram; these are merged once the scan is done. Progress is          */
+/* reported per scan group; a FALSE return cancels the scan.               */
+/***************************************************************************/
+CPLErr NisarRasterBand::StreamStatistics(NisarStats::Partial* poStats, double dfHistMin, double dfHistMax,
+                                         int nBuckets, bool bIncludeOutOfRange, GUIntBig* panHistogram,
+                                         GDALProgressFunc pfnProgress, void* pProgressData)
+{
+    auto t_start = std::chrono::high_resolution_clock::now();
+
+    // Complex magnitudes are never compared with the nodata value
+    int bHasNoData = FALSE;
+    const double dfNoData = GetNoDataValue(&bHasNoData);
+    const bool bCheckNoData = bHasNoData && !GDALDataTypeIsComplex(eDataType);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+
+    const int nWorkers = GetDecodeThreadCount();
+    std::vector<NisarStats::Partial> aoPartials(nWorkers);
+    std::vector<std::vector<GUIntBig>> aanHistograms(nWorkers);
+    std::vector<std::vector<double>> aadfValues(nWorkers);
+
+    const ChunkVisitor fnVisit = [&](int iWorker, const GByte* pabyPixels, int nCols, int nRows, size_t nLineStride) {
+        std::vector<double>& adfValues = aadfValues[iWorker];
+        const size_t nValues = static_cast<size_t>(nCols) * nRows;
+        adfValues.resize(nValues);
+        for (int y = 0; y < nRows; y++) {
+            NisarStats::ToDouble(pabyPixels + static_cast<size_t>(y) * nLineStride * nDTSize, eDataType, nCols,
+                                 adfValues.data() + static_cast<size_t>(y) * nCols);
+        }
+        if (poStats) NisarStats::Accumulate(adfValues.data(), nValues, bCheckNoData, dfNoData, aoPartials[iWorker]);
+        if (panHistogram) {
+            std::vector<GUIntBig>& anHistogram = aanHistograms[iWorker];
+            if (anHistogram.empty()) anHistogram.assign(nBuckets, 0);
+            NisarStats::Histogram(adfValues.data(), nValues, bCheckNoData, dfNoData, dfHistMin, dfHistMax, nBuckets,
+                                  bIncludeOutOfRange, anHistogram.data());
+        }
+    };
+
+    const CPLErr eErr = ScanInFileOrder(0, 0, nRasterXSize, nRasterYSize, nullptr, eDataType, 0, 0, false, &fnVisit,
+                                        pfnProgress, pProgressData);
+    if (eErr != CE_None) return eErr;
+
+    if (poStats) {
+        *poStats = NisarStats::Partial();
+        for (const auto& oPartial : aoPartials) NisarStats::Merge(*poStats, oPartial);
+    }
+    if (panHistogram) {
+        for (const auto& anHistogram : aanHistograms) {
+            for (size_t i = 0; i < anHistogram.size(); i++) panHistogram[i] += anHistogram[i];
+        }
+    }
+
+    std::chrono::duration<double, std::milli> t_diff = std::chrono::high_resolution_clock::now() - t_start;
+    CPLDebug("NISAR_DRIVER", "Band %d: exact %s%s%s | Valid: " CPL_FRMT_GUIB " | Time: %.3f ms", nBand,
+             poStats ? "statistics" : "", poStats && panHistogram ? " and " : "", panHistogram ? "histogram" : "",
+             poStats ? poStats->nValid : static_cast<GUIntBig>(0), t_diff.count());
+    return CE_None;
+}
+
 CPLErr NisarRasterBand::GetStatistics(int bApproxOK, int bForce,
                                       double *pdfMin, double *pdfMax,
                                       double *pdfMean, double *pdfStdDev)
@@ -1095,10 +3211,111 @@ CPLErr NisarRasterBand::GetStatistics(int bApproxOK, int bForce,
         return CE_None;
     }
 
+    // Exact statistics: a previous scan persisted in PAM, else one native scan
+    if (CanStreamStatistics()) {
+        const char* pszMin = GetMetadataItem("STATISTICS_MINIMUM");
+        const char* pszMax = GetMetadataItem("STATISTICS_MAXIMUM");
+        const char* pszMean = GetMetadataItem("STATISTICS_MEAN");
+        const char* pszStdDev = GetMetadataItem("STATISTICS_STDDEV");
+        if (pszMin && pszMax && pszMean && pszStdDev && !GetMetadataItem("STATISTICS_APPROXIMATE")) {
+            if (pdfMin) *pdfMin = CPLAtof(pszMin);
+            if (pdfMax) *pdfMax = CPLAtof(pszMax);
+            if (pdfMean) *pdfMean = CPLAtof(pszMean);
+            if (pdfStdDev) *pdfStdDev = CPLAtof(pszStdDev);
+            return CE_None;
+        }
+        if (!bForce) return CE_Warning;
+
+        NisarStats::Partial oStats;
+        CPLErr eErr = StreamStatistics(&oStats, 0, 0, 0, false, nullptr);
+        if (eErr != CE_None) return eErr;
+        if (oStats.nValid == 0) {
+            CPLError(CE_Failure, CPLE_AppDefined, "NISAR: Failed to compute statistics, no valid pixels found.");
+            return CE_Failure;
+        }
+
+        // Population standard deviation, as GDAL reports it
+        const double dfStdDev = sqrt(oStats.dfM2 / static_cast<double>(oStats.nValid));
+        SetStatistics(oStats.dfMin, oStats.dfMax, oStats.dfMean, dfStdDev);
+        SetMetadataItem("STATISTICS_VALID_PERCENT",
+                        CPLSPrintf("%.4g", 100.0 * static_cast<double>(oStats.nValid) /
+                                               (static_cast<double>(nRasterXSize) * nRasterYSize)));
+
+        if (pdfMin) *pdfMin = oStats.dfMin;
+        if (pdfMax) *pdfMax = oStats.dfMax;
+        if (pdfMean) *pdfMean = oStats.dfMean;
+        if (pdfStdDev) *pdfStdDev = dfStdDev;
+        return CE_None;
+    }
+
     // Deep scan fallback
     return GDALPamRasterBand::GetStatistics(bApproxOK, bForce, pdfMin, pdfMax, pdfMean, pdfStdDev);
 }
 
+CPLErr NisarRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets, GUIntBig* panHistogram,
+                                     int bIncludeOutOfRange, int bApproxOK,
+                                     GDALProgressFunc pfnProgress, void* pProgressData)
+{
+    // Approximate histograms come from overviews through GDAL
+    if (bApproxOK || !CanStreamStatistics() || nBuckets < 1 || !(dfMax > dfMin)) {
+        return GDALPamRasterBand::GetHistogram(dfMin, dfMax, nBuckets, panHistogram, bIncludeOutOfRange, bApproxOK,
+                                               pfnProgress, pProgressData);
+    }
+
+    if (pfnProgress == nullptr) pfnProgress = GDALDummyProgress;
+    if (!pfnProgress(0.0, nullptr, pProgressData)) {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    memset(panHistogram, 0, sizeof(GUIntBig) * nBuckets);
+    const CPLErr eErr = StreamStatistics(nullptr, dfMin, dfMax, nBuckets, bIncludeOutOfRange != FALSE, panHistogram,
+                                         pfnProgress, pProgressData);
+    if (eErr == CE_None) pfnProgress(1.0, nullptr, pProgressData);
+    return eErr;
+}
+
+CPLErr NisarRasterBand::GetDefaultHistogram(double* pdfMin, double* pdfMax, int* pnBuckets,
+                                            GUIntBig** ppanHistogram, int bForce,
+                                            GDALProgressFunc pfnProgress, void* pProgressData)
+{
+    if (!CanStreamStatistics()) {
+        return GDALPamRasterBand::GetDefaultHistogram(pdfMin, pdfMax, pnBuckets, ppanHistogram, bForce,
+                                                      pfnProgress, pProgressData);
+    }
+
+    // A default histogram saved in PAM by an earlier run
+    CPLErr eErr = GDALPamRasterBand::GetDefaultHistogram(pdfMin, pdfMax, pnBuckets, ppanHistogram, FALSE,
+                                                         pfnProgress, pProgressData);
+    if (eErr != CE_Warning || !bForce) return eErr;
+
+    // GDAL's layout: 256 buckets over the exact range, centred on each byte value
+    double dfMin = -0.5, dfMax = 255.5;
+    if (eDataType != GDT_Byte) {
+        eErr = GetStatistics(FALSE, TRUE, &dfMin, &dfMax, nullptr, nullptr);
+        if (eErr != CE_None) return eErr;
+        const double dfHalfBucket = (dfMax > dfMin) ? (dfMax - dfMin) / (2 * 255) : 0.5;
+        dfMin -= dfHalfBucket;
+        dfMax += dfHalfBucket;
+    }
+
+    const int nBuckets = 256;
+    GUIntBig* panHistogram = static_cast<GUIntBig*>(VSI_CALLOC_VERBOSE(sizeof(GUIntBig), nBuckets));
+    if (panHistogram == nullptr) return CE_Failure;
+    eErr = GetHistogram(dfMin, dfMax, nBuckets, panHistogram, TRUE, FALSE, pfnProgress, pProgressData);
+    if (eErr != CE_None) {
+        CPLFree(panHistogram);
+        return eErr;
+    }
+
+    SetDefaultHistogram(dfMin, dfMax, nBuckets, panHistogram);
+    *pdfMin = dfMin;
+    *pdfMax = dfMax;
+    *pnBuckets = nBuckets;
+    *ppanHistogram = panHistogram;
+    return CE_None;
+}
+
 // And the Min/Max overrides just call GetStatistics to avoid duplicating the CPLAtof logic!
 double NisarRasterBand::GetMinimum(int* pbSuccess) {
     double dfMin = 0.0;
@@ -1114,132 +3331,6 @@ double NisarRasterBand::GetMaximum(int* pbSuccess) {
     return dfMax;
 }
 
-NisarHDF5MaskBand::~NisarHDF5MaskBand()
-{
-    // CLEANLY RELEASE CACHED SPACE
-    if (m_hMaskFileSpaceID >= 0)
-    {
-        H5Sclose(m_hMaskFileSpaceID);
-        m_hMaskFileSpaceID = -1;
-    }
-
-    if (m_hMaskDS >= 0) {
-        H5Dclose(m_hMaskDS);
-    }
-}
-CPLErr NisarHDF5MaskBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
-{
-    if (m_hMaskDS < 0 || m_hMaskFileSpaceID < 0) return CE_Failure;
-
-    // Pre-fill the GDAL buffer with 0 (Invalid) to handle partial block padding
-    int nFullBlockPixels = nBlockXSize * nBlockYSize;
-    memset(pImage, 0, nFullBlockPixels);
-
-    // Calculate offsets for HDF5 Hyperslab
-    hsize_t offset[2] = {
-        static_cast<hsize_t>(nBlockYOff) * nBlockYSize,
-        static_cast<hsize_t>(nBlockXOff) * nBlockXSize
-    };
-
-    // Handle edge blocks
-    int nRequestX = nBlockXSize;
-    int nRequestY = nBlockYSize;
-
-    if (offset[0] + nRequestY > static_cast<hsize_t>(nRasterYSize))
-        nRequestY = nRasterYSize - offset[0];
-    if (offset[1] + nRequestX > static_cast<hsize_t>(nRasterXSize))
-        nRequestX = nRasterXSize - offset[1];
-
-    hsize_t count[2] = { static_cast<hsize_t>(nRequestY), static_cast<hsize_t>(nRequestX) };
-
-    // Create a memory space matching GDAL's full block dimensions
-    hsize_t mem_dims[2] = { static_cast<hsize_t>(nBlockYSize), static_cast<hsize_t>(nBlockXSize) };
-    hid_t hMemSpace = H5Screate_simple(2, mem_dims, nullptr);
-
-    // If it's a partial block, select a hyperslab in the memory space
-    if (nRequestX < nBlockXSize || nRequestY < nBlockYSize) {
-        hsize_t mem_start[2] = {0, 0};
-        H5Sselect_hyperslab(hMemSpace, H5S_SELECT_SET, mem_start, nullptr, count, nullptr);
-    }
-
-    hid_t hFileSpace = H5Scopy(m_hMaskFileSpaceID);
-    H5Sselect_hyperslab(hFileSpace, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-
-    // Read into the buffer provided by GDAL
-    GByte* pbyBuffer = static_cast<GByte*>(pImage);
-
-    // INSTRUMENTATION START
-    auto t_start = std::chrono::high_resolution_clock::now();
-
-    herr_t status = H5Dread(m_hMaskDS, H5T_NATIVE_UINT8, hMemSpace, hFileSpace, H5P_DEFAULT, pbyBuffer);
-
-    auto t_end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double, std::milli> t_diff = t_end - t_start;
-
-    CPLDebug("NISAR_MASK_PERF", 
-             "Mask H5Dread Block(X:%d, Y:%d) | RequestSize: %dx%d | Time: %.3f ms",
-             nBlockXOff, nBlockYOff, nRequestX, nRequestY, t_diff.count());
-    // INSTRUMENTATION END
-
-    H5Sclose(hFileSpace);
-    H5Sclose(hMemSpace);
-
-    if (status < 0) return CE_Failure;
-
-        // LUT Optimization for Mask Iteration
-        // Static initialization ensures the LUT is built only once per application lifecycle
-        if (m_eType == NisarMaskType::GCOV)
-        {
-#if defined(__aarch64__) || defined(_M_ARM64)
-            // NEON Vectorized Thresholding (16 pixels per cycle)
-            uint8x16_t v_min = vdupq_n_u8(1);
-            uint8x16_t v_max = vdupq_n_u8(5);
-            int i = 0;
-            for (; i + 15 < nFullBlockPixels; i += 16) {
-                uint8x16_t pixels = vld1q_u8(pbyBuffer + i);
-                
-                // Compare: pixels >= 1  (Returns 0xFF or 0x00)
-                uint8x16_t mask1 = vcgeq_u8(pixels, v_min);
-                // Compare: pixels <= 5  (Returns 0xFF or 0x00)
-                uint8x16_t mask2 = vcleq_u8(pixels, v_max);
-                
-                // Bitwise AND combines the conditions. The result is instantly our 255/0 mask!
-                vst1q_u8(pbyBuffer + i, vandq_u8(mask1, mask2));
-            }
-            // Scalar Tail
-            for (; i < nFullBlockPixels; i++) {
-                pbyBuffer[i] = (pbyBuffer[i] >= 1 && pbyBuffer[i] <= 5) ? 255 : 0;
-            }
-#else
-            static const auto gcovLUT = []() {
-            std::vector<GByte> lut(256, 0);
-            for (int i = 1; i <= 5; i++) lut[i] = 255;
-                return lut;
-            }();
-
-            for (int i = 0; i < nFullBlockPixels; i++) {
-                pbyBuffer[i] = gcovLUT[pbyBuffer[i]];
-            }
-#endif
-        }
-        else if (m_eType == NisarMaskType::GUNW)
-        {
-            static const auto gunwLUT = []() {
-                std::vector<GByte> lut(256, 0);
-                for (int v = 1; v < 255; v++) {
-                    int nRefSubswath = (v / 10) % 10;
-                    int nSecSubswath = v % 10;
-                    lut[v] = (nRefSubswath > 0 && nSecSubswath > 0) ? 255 : 0;
-                }
-                return lut;
-                }();
-
-            for (int i = 0; i < nFullBlockPixels; i++) {
-                pbyBuffer[i] = gunwLUT[pbyBuffer[i]];
-            }
-        }
-        return CE_None;
-}
 bool NisarRasterBand::WriteVirtualZarrSidecar(
     const std::string& osS3Url, 
     const std::string& osZarrGroupPath, // e.g., "science/LSAR/GCOV/grids/frequencyA/HHHH"
@@ -1261,9 +3352,9 @@ bool NisarRasterBand::WriteVirtualZarrSidecar(
     oZarray.Add("order", "C"); // Define C-contiguous memory layout
     oZarray.Add("zarr_format", 2);
     
-    // Map GDAL eDataType to Zarr Format 2 Typestrings
+    // Map the stored GDAL type to Zarr Format 2 Typestrings
     std::string osDtype; 
-    switch(eDataType) {
+    switch(m_eStorageType) {
         case GDT_Byte:     osDtype = "|u1"; break;
         case GDT_Int16:    osDtype = "<i2"; break;
         case GDT_UInt16:   osDtype = "<u2"; break;
@@ -1285,8 +3376,8 @@ bool NisarRasterBand::WriteVirtualZarrSidecar(
     oZarray.Add("shape", oShape);
     
     CPLJSONArray oZChunks;
-    oZChunks.Add(nBlockYSize); 
-    oZChunks.Add(nBlockXSize);
+    oZChunks.Add(m_nChunkYSize); 
+    oZChunks.Add(m_nChunkXSize);
     oZarray.Add("chunks", oZChunks);
 
     // Map the NoData Value to Zarr's fill_value
@@ -1314,7 +3405,7 @@ bool NisarRasterBand::WriteVirtualZarrSidecar(
         CPLJSONArray oFilters;
         CPLJSONObject oShuffle;
         oShuffle.Add("id", "shuffle");
-        oShuffle.Add("elementsize", GDALGetDataTypeSizeBytes(eDataType));
+        oShuffle.Add("elementsize", GDALGetDataTypeSizeBytes(m_eStorageType));
         oFilters.Add(oShuffle);
         oZarray.Add("filters", oFilters);
     }
@@ -13,7 +13,10 @@
 #ifndef NISAR_RASTER_BAND_H
 #define NISAR_RASTER_BAND_H
 
+#include <atomic>
+#include <functional>
 #include <mutex>
+#include <thread>
 #include <cmath> // for std::isnan
 
 #include <zlib.h> //Deflate decompression
@@ -26,9 +29,27 @@
 #include "cpl_json.h"
 #include "cpl_vsi.h"
 
+#include "nisarderived.h"
+#include "nisarfilters.h"
+#include "nisarstats.h"
+
 class NisarDataset;
 class NisarOverviewBand;
-class NisarHDF5MaskBand;
+
+// Define the logic strategy for the mask
+enum class NisarMaskType {
+    GCOV, // Logic: 1-5 Valid; 0, 255 Invalid
+    GUNW  // Logic: Digit parsing (Ref != 0 && Sec != 0)
+};
+
+// Mask chunk summary (NISAR_MASK_SUMMARY): what a mask chunk, or a window
+// of them, holds once decoded. Unknown chunks count as Mixed.
+enum class NisarMaskCoverage : GByte {
+    Unknown,
+    AllInvalid,
+    AllValid,
+    Mixed
+};
 
 
 /***************************************************************************/
@@ -49,6 +70,31 @@ class NisarRasterBand final : public GDALPamRasterBand
       std::mutex m_oMegaFetchMutex;
       VSILFILE* m_fp = nullptr; // shared file pointer opened in the Dataset
       hid_t hH5Type = -1;  // Store copy of HDF5 native data type
+      hid_t m_hDataset = -1; // HDF5 dataset read by this band (owned for masks)
+      int m_iSlice = 0;      // Z index into 3D datasets
+      // Layer mask band (nBand 0): the sibling "mask" dataset, decoded by
+      // this same engine and mapped to 0/255 as each chunk is decoded
+      bool m_bIsMask = false;
+      NisarMaskType m_eMaskType = NisarMaskType::GCOV;
+      // APPLY_MASK: invalid pixels are overwritten with this one pixel
+      // (nodata, or NaN) as blocks leave the decoder
+      bool m_bApplyMask = false;
+      std::vector<GByte> m_abyMaskedPixel;
+      // Mask bands: NisarMaskCoverage of each chunk, built (or loaded from
+      // NISAR_OVR_CACHE_DIR) on first use and read-only afterwards
+      std::mutex m_oCoverageMutex;
+      std::atomic<bool> m_bCoverageChecked{false};
+      std::vector<GByte> m_abyChunkCoverage;
+      void EnsureCoverageSummary();
+      void BuildCoverageSummary();
+      NisarMaskCoverage GetMaskCoverage(int nXOff, int nYOff, int nXSize, int nYSize) const;
+      // Data bands: coverage of the applied mask over a window (APPLY_MASK)
+      NisarMaskCoverage GetAppliedMaskCoverage(int nXOff, int nYOff, int nXSize, int nYSize) const;
+      // Type of the stored samples. eDataType differs only for DERIVED
+      // bands, where chunks decode to Float32 on the way to the block.
+      GDALDataType m_eStorageType = GDT_Unknown;
+      NisarDerived::Kind m_eDerived = NisarDerived::Kind::None;
+      bool m_bDerivedFast = true;
       // Cached HDF5 handles
       hid_t m_hFileSpaceID = -1;  // Cached filespace for the HDF5 dataset
       hid_t m_hMemSpaceID = -1;   // Cached memory space for a full block
@@ -56,13 +102,29 @@ class NisarRasterBand final : public GDALPamRasterBand
       bool m_bIsDeflated = false;
       int m_nDeflateLevel = 1;
       bool m_bIsShuffled = false;
+      NisarFilters::FilterPipeline m_oFilters; // Full pipeline from the DCPL
       bool m_bNeedsEndianSwap = false;
 
       bool m_bHasMinMax = false;
 
       std::vector<std::unique_ptr<NisarOverviewBand>> m_apoOverviews;
-      NisarHDF5MaskBand* m_poMaskBand = nullptr; // Cache the mask band
-      bool m_bMaskBandOwned = false;
+
+      // Persisted overview cache (NISAR_OVR_CACHE_DIR): looked up on first
+      // overview access, built in the background when missing
+      bool m_bOvrCacheChecked = false;
+      std::string m_osOvrCachePath;
+      std::string m_osOvrCacheIdentity;
+      GDALDataset* m_poOvrCacheDS = nullptr;
+      std::thread m_oOvrCacheBuild;
+      std::atomic<bool> m_bStopOvrCacheBuild{false};
+      std::atomic<bool> m_bOvrCacheBuilt{false};
+      void UpdateOverviewCache();
+      bool AttachOverviewCache();
+      NisarRasterBand* m_poMaskBand = nullptr; // Cache the mask band (owned by the dataset)
+      NisarRasterBand* FindLayerMask();
+      bool EnableApplyMask();
+      // pabyMask == nullptr: read the mask window through m_poMaskBand
+      bool ApplyLayerMask(int nBlockX, int nBlockY, GByte* pabyBlock, const GByte* pabyMask = nullptr);
 
       struct NisarChunkInfo {
           int nBlockX;
@@ -70,22 +132,103 @@ class NisarRasterBand final : public GDALPamRasterBand
           vsi_l_offset nOffset;
           size_t nLength;
           bool bIsMissing;
+          unsigned int nFilterMask = 0; // Bit i set: filter i skipped for this chunk
+          bool bIsConstant = false;     // Every pixel equals abyConstant
+          GByte abyConstant[16] = {0};  // Large enough for CFloat64
       };
       
-      // The class-level cache for our B-Tree layout
+      // The class-level cache for our B-Tree layout, indexed on the chunk grid
       std::vector<NisarChunkInfo> m_aoAllChunks;
+
+      // HDF5 chunk shape. Equal to the block size unless BLOCK_MULTIPLE /
+      // BLOCK_SIZE groups several chunks into one synthetic GDAL block.
+      int m_nChunkXSize = 0;
+      int m_nChunkYSize = 0;
+      int m_nChunksPerRow = 0;
+      int m_nChunksPerCol = 0;
+
+      // Contiguous / compact layouts: m_aoAllChunks holds synthetic row
+      // strips of the single storage extent. Compact data is held in memory.
+      bool m_bRawLayout = false;
+      std::vector<GByte> m_abyCompactData;
+
+      // One pixel of the value unallocated chunks read as, in host order
+      std::vector<GByte> m_abyFillPixel;
+      bool m_bNonZeroFill = false;
+      void InitFillValue(hid_t hDatasetID, hid_t hDCPL);
+      // pabyPixel (a stored sample) == nullptr: the fill value
+      void FillPixels(GByte* pabyDst, size_t nPixels, const GByte* pabyPixel = nullptr) const;
+      void FillChunkInBlock(int nChunkX, int nChunkY, const GByte* pabyPixel, GByte* pabyBlock) const;
+
+      // Constant chunks (NISAR_DETECT_CONSTANT_CHUNKS): found once in the
+      // background and then served as a fill, without fetch or inflate
+      std::thread m_oConstantScan;
+      std::atomic<bool> m_bStopConstantScan{false};
+      void DetectConstantChunks(std::string sRawPath);
+
+      // Hedged fetch threads (NISAR_HEDGE_REQUESTS, NISAR_READ_DEADLINE_MS):
+      // dropped and losing requests finish here; finished ones are joined on
+      // the next hedged fetch, the rest in the destructor
+      struct FetchThread
+      {
+          std::thread oThread;
+          std::shared_ptr<std::atomic<bool>> pbFinished;
+      };
+      std::mutex m_oFetchThreadsMutex;
+      std::vector<FetchThread> m_aoFetchThreads;
+      void StartFetchThread(std::function<void()> fnWork);
+      void JoinFetchThreads(bool bAll);
+      bool FetchRangesHedged(const std::string& sPath, const std::vector<vsi_l_offset>& anOffsets,
+                             const std::vector<size_t>& anSizes, std::vector<void*>& apData,
+                             const std::vector<bool>& abRequired);
       
-      bool ProcessAndCopyChunk(const GByte* pSrcData, size_t nSrcSize, void* pDstData);
+      void Initialize(NisarDataset *poDSIn, int nBandIn, hid_t hDatasetID);
+      void BuildRawLayoutIndex(hid_t hDatasetID, int rank);
+      // bDerive = false: stored samples even on a DERIVED or mask band
+      bool ProcessAndCopyChunk(const GByte* pSrcData, size_t nSrcSize, unsigned int nFilterMask,
+                               void* pDstData, bool bDerive = true);
+      bool DecodeChunkIntoBlock(const GByte* pSrcData, size_t nSrcSize, unsigned int nFilterMask,
+                                int nChunkX, int nChunkY, GByte* pabyBlock);
+      // Raw chunk access for NisarDataset::ReadCompressedData()
+      const NisarChunkInfo* GetChunkForWindow(int nXOff, int nYOff, int nXSize, int nYSize) const;
+      std::string GetCompressedChunkFormat() const;
+      CPLErr ReadBlocksThroughHDF5(const std::vector<std::pair<int, int>>& aoBlocks,
+                                   int nBlockXOff, int nBlockYOff, void* pImage);
+      bool IsFileOrderScanWindow(int nXOff, int nYOff, int nXSize, int nYSize) const;
+      // Takes the in-window part of each decoded chunk (nLineStride in
+      // pixels); calls from one decode worker share iWorker
+      using ChunkVisitor = std::function<void(int iWorker, const GByte* pabyPixels, int nCols, int nRows,
+                                              size_t nLineStride)>;
+      CPLErr ScanInFileOrder(int nXOff, int nYOff, int nXSize, int nYSize,
+                             void* pData, GDALDataType eBufType,
+                             GSpacing nPixelSpace, GSpacing nLineSpace,
+                             bool bFillCache, const ChunkVisitor* pfnVisitor = nullptr,
+                             GDALProgressFunc pfnProgress = nullptr, void* pProgressData = nullptr);
+      // Exact statistics and/or histogram of the whole band in one scan
+      bool CanStreamStatistics() const;
+      CPLErr StreamStatistics(NisarStats::Partial* poStats, double dfHistMin, double dfHistMax, int nBuckets,
+                              bool bIncludeOutOfRange, GUIntBig* panHistogram,
+                              GDALProgressFunc pfnProgress = nullptr, void* pProgressData = nullptr);
       std::string GetRawVSIPath() const;
       std::string GetStandardDatasetURI() const;
 
   public:
-    NisarRasterBand(NisarDataset *poDSIn, int nBandIn, hid_t hDatasetID,
-                    hid_t hH5DatasetType);
     NisarRasterBand(NisarDataset *poDS, int nBand);
+    // Layer mask over slice iSlice of hMaskDS; takes ownership of hMaskDS
+    NisarRasterBand(NisarDataset *poDSIn, hid_t hMaskDS, NisarMaskType eMaskType, int iSlice);
     virtual ~NisarRasterBand() override;
     virtual CPLErr IReadBlock(int nBlockXOff, int nBlockYOff,
                               void *pImage) override;
+    virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+                             void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+                             GSpacing nPixelSpace, GSpacing nLineSpace,
+                             GDALRasterIOExtraArg *psExtraArg) override;
+    virtual CPLErr AdviseRead(int nXOff, int nYOff, int nXSize, int nYSize,
+                              int nBufXSize, int nBufYSize, GDALDataType eDT,
+                              char **papszOptions) override;
+
+    virtual int IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize, int nYSize,
+                                       int nMaskFlagStop, double* pdfDataPct) override;
 
     virtual GDALRasterBand* GetMaskBand() override;
     virtual int GetMaskFlags() override;
@@ -95,8 +238,15 @@ class NisarRasterBand final : public GDALPamRasterBand
     virtual CPLErr GetStatistics(int bApproxOK, int bForce,
                                  double *pdfMin, double *pdfMax,
                                  double *pdfMean, double *pdfStdDev) override;
+    virtual CPLErr GetHistogram(double dfMin, double dfMax, int nBuckets, GUIntBig *panHistogram,
+                                int bIncludeOutOfRange, int bApproxOK,
+                                GDALProgressFunc pfnProgress, void *pProgressData) override;
+    virtual CPLErr GetDefaultHistogram(double *pdfMin, double *pdfMax, int *pnBuckets, GUIntBig **ppanHistogram,
+                                       int bForce, GDALProgressFunc pfnProgress, void *pProgressData) override;
 
     static thread_local bool bDisableOverviewRouting;
+    // Set by sampled overviews: IReadBlock fetches only the requested block
+    static thread_local bool bDisablePrefetch;
     virtual int GetOverviewCount() override;
     virtual GDALRasterBand* GetOverview(int i) override;
 
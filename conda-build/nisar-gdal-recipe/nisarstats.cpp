@@ -0,0 +1,268 @@
+// nisarstats.cpp
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#include "nisarstats.h"
+
+#include "cpl_conv.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace NisarStats
+{
+
+namespace
+{
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+inline bool IsValid(double v, bool bHasNoData, double dfNoData)
+{
+    return !std::isnan(v) && !(bHasNoData && v == dfNoData);
+}
+
+#ifdef __AVX2__
+inline __m256d ValidLanes(__m256d v, bool bHasNoData, __m256d vNoData)
+{
+    __m256d m = _mm256_cmp_pd(v, v, _CMP_ORD_Q);
+    if (bHasNoData) m = _mm256_and_pd(m, _mm256_cmp_pd(v, vNoData, _CMP_NEQ_OQ));
+    return m;
+}
+
+inline double HorizontalSum(__m256d v)
+{
+    alignas(32) double ad[4];
+    _mm256_store_pd(ad, v);
+    return (ad[0] + ad[1]) + (ad[2] + ad[3]);
+}
+#elif defined(__aarch64__) || defined(_M_ARM64)
+inline uint64x2_t ValidLanes(float64x2_t v, bool bHasNoData, float64x2_t vNoData)
+{
+    uint64x2_t m = vceqq_f64(v, v);
+    if (bHasNoData) m = vbicq_u64(m, vceqq_f64(v, vNoData));
+    return m;
+}
+
+inline float64x2_t MaskLanes(float64x2_t v, uint64x2_t m)
+{
+    return vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(v), m));
+}
+#endif
+
+}  // namespace
+
+void Accumulate(const double *padfValues, size_t nValues, bool bHasNoData, double dfNoData, Partial &oPartial)
+{
+    // A NaN nodata value is already excluded as NaN
+    if (std::isnan(dfNoData)) bHasNoData = false;
+
+    // Pass 1: count, range and mean of this batch
+    GUIntBig nValid = 0;
+    double dfMin = kInf, dfMax = -kInf, dfSum = 0;
+    size_t i = 0;
+#ifdef __AVX2__
+    {
+        const __m256d vNoData = _mm256_set1_pd(dfNoData), vOne = _mm256_set1_pd(1.0);
+        const __m256d vInf = _mm256_set1_pd(kInf), vNegInf = _mm256_set1_pd(-kInf);
+        __m256d vMin = vInf, vMax = vNegInf, vSum = _mm256_setzero_pd(), vCount = _mm256_setzero_pd();
+        for (; i + 4 <= nValues; i += 4) {
+            const __m256d v = _mm256_loadu_pd(padfValues + i);
+            const __m256d m = ValidLanes(v, bHasNoData, vNoData);
+            vMin = _mm256_min_pd(vMin, _mm256_blendv_pd(vInf, v, m));
+            vMax = _mm256_max_pd(vMax, _mm256_blendv_pd(vNegInf, v, m));
+            vSum = _mm256_add_pd(vSum, _mm256_and_pd(v, m));
+            vCount = _mm256_add_pd(vCount, _mm256_and_pd(vOne, m));
+        }
+        alignas(32) double adMin[4], adMax[4];
+        _mm256_store_pd(adMin, vMin);
+        _mm256_store_pd(adMax, vMax);
+        for (int k = 0; k < 4; k++) {
+            dfMin = std::min(dfMin, adMin[k]);
+            dfMax = std::max(dfMax, adMax[k]);
+        }
+        dfSum = HorizontalSum(vSum);
+        nValid = static_cast<GUIntBig>(HorizontalSum(vCount));
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    {
+        const float64x2_t vNoData = vdupq_n_f64(dfNoData);
+        const float64x2_t vInf = vdupq_n_f64(kInf), vNegInf = vdupq_n_f64(-kInf);
+        float64x2_t vMin = vInf, vMax = vNegInf, vSum = vdupq_n_f64(0.0);
+        uint64x2_t vCount = vdupq_n_u64(0);
+        for (; i + 2 <= nValues; i += 2) {
+            const float64x2_t v = vld1q_f64(padfValues + i);
+            const uint64x2_t m = ValidLanes(v, bHasNoData, vNoData);
+            vMin = vminq_f64(vMin, vbslq_f64(m, v, vInf));
+            vMax = vmaxq_f64(vMax, vbslq_f64(m, v, vNegInf));
+            vSum = vaddq_f64(vSum, MaskLanes(v, m));
+            vCount = vsubq_u64(vCount, m);  // All-ones lanes count as -1
+        }
+        dfMin = vminvq_f64(vMin);
+        dfMax = vmaxvq_f64(vMax);
+        dfSum = vaddvq_f64(vSum);
+        nValid = vgetq_lane_u64(vCount, 0) + vgetq_lane_u64(vCount, 1);
+    }
+#endif
+    for (size_t j = i; j < nValues; j++) {
+        const double v = padfValues[j];
+        if (!IsValid(v, bHasNoData, dfNoData)) continue;
+        dfMin = std::min(dfMin, v);
+        dfMax = std::max(dfMax, v);
+        dfSum += v;
+        nValid++;
+    }
+    if (nValid == 0) return;
+
+    // Pass 2: squared deviations from the batch mean, while it is in cache
+    const double dfMean = dfSum / static_cast<double>(nValid);
+    double dfM2 = 0;
+    i = 0;
+#ifdef __AVX2__
+    {
+        const __m256d vNoData = _mm256_set1_pd(dfNoData), vMean = _mm256_set1_pd(dfMean);
+        __m256d vM2 = _mm256_setzero_pd();
+        for (; i + 4 <= nValues; i += 4) {
+            const __m256d v = _mm256_loadu_pd(padfValues + i);
+            const __m256d d = _mm256_sub_pd(v, vMean);
+            vM2 = _mm256_add_pd(vM2, _mm256_and_pd(_mm256_mul_pd(d, d), ValidLanes(v, bHasNoData, vNoData)));
+        }
+        dfM2 = HorizontalSum(vM2);
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    {
+        const float64x2_t vNoData = vdupq_n_f64(dfNoData), vMean = vdupq_n_f64(dfMean);
+        float64x2_t vM2 = vdupq_n_f64(0.0);
+        for (; i + 2 <= nValues; i += 2) {
+            const float64x2_t v = vld1q_f64(padfValues + i);
+            const float64x2_t d = vsubq_f64(v, vMean);
+            vM2 = vaddq_f64(vM2, MaskLanes(vmulq_f64(d, d), ValidLanes(v, bHasNoData, vNoData)));
+        }
+        dfM2 = vaddvq_f64(vM2);
+    }
+#endif
+    for (; i < nValues; i++) {
+        const double v = padfValues[i];
+        if (IsValid(v, bHasNoData, dfNoData)) dfM2 += (v - dfMean) * (v - dfMean);
+    }
+
+    Partial oBatch;
+    oBatch.nValid = nValid;
+    oBatch.dfMin = dfMin;
+    oBatch.dfMax = dfMax;
+    oBatch.dfMean = dfMean;
+    oBatch.dfM2 = dfM2;
+    Merge(oPartial, oBatch);
+}
+
+void Merge(Partial &oInto, const Partial &oOther)
+{
+    if (oOther.nValid == 0) return;
+    if (oInto.nValid == 0) {
+        oInto = oOther;
+        return;
+    }
+    const double dfCountA = static_cast<double>(oInto.nValid), dfCountB = static_cast<double>(oOther.nValid);
+    const double dfCount = dfCountA + dfCountB;
+    const double dfDelta = oOther.dfMean - oInto.dfMean;
+    oInto.dfMean += dfDelta * dfCountB / dfCount;
+    oInto.dfM2 += oOther.dfM2 + dfDelta * dfDelta * dfCountA * dfCountB / dfCount;
+    oInto.dfMin = std::min(oInto.dfMin, oOther.dfMin);
+    oInto.dfMax = std::max(oInto.dfMax, oOther.dfMax);
+    oInto.nValid += oOther.nValid;
+}
+
+void Histogram(const double *padfValues, size_t nValues, bool bHasNoData, double dfNoData, double dfMin,
+               double dfMax, int nBuckets, bool bIncludeOutOfRange, GUIntBig *panHistogram)
+{
+    if (std::isnan(dfNoData)) bHasNoData = false;
+    const double dfScale = nBuckets / (dfMax - dfMin);
+
+    // Bucket -1 and nBuckets stand for below and above the range
+    auto Count = [&](int nIndex) {
+        if (nIndex < 0) {
+            if (bIncludeOutOfRange) panHistogram[0]++;
+        } else if (nIndex >= nBuckets) {
+            if (bIncludeOutOfRange) panHistogram[nBuckets - 1]++;
+        } else {
+            panHistogram[nIndex]++;
+        }
+    };
+
+    size_t i = 0;
+#ifdef __AVX2__
+    {
+        // Indices are computed four at a time, clamped before the conversion
+        const __m256d vNoData = _mm256_set1_pd(dfNoData), vMin = _mm256_set1_pd(dfMin);
+        const __m256d vScale = _mm256_set1_pd(dfScale);
+        const __m256d vLow = _mm256_set1_pd(-1.0), vHigh = _mm256_set1_pd(static_cast<double>(nBuckets));
+        alignas(16) int anIndex[4];
+        for (; i + 4 <= nValues; i += 4) {
+            const __m256d v = _mm256_loadu_pd(padfValues + i);
+            const int nValidBits = _mm256_movemask_pd(ValidLanes(v, bHasNoData, vNoData));
+            if (nValidBits == 0) continue;
+            __m256d vIndex = _mm256_floor_pd(_mm256_mul_pd(_mm256_sub_pd(v, vMin), vScale));
+            vIndex = _mm256_min_pd(_mm256_max_pd(vIndex, vLow), vHigh);
+            _mm_store_si128(reinterpret_cast<__m128i *>(anIndex), _mm256_cvttpd_epi32(vIndex));
+            for (int k = 0; k < 4; k++) {
+                if (nValidBits & (1 << k)) Count(anIndex[k]);
+            }
+        }
+    }
+#endif
+    for (; i < nValues; i++) {
+        const double v = padfValues[i];
+        if (!IsValid(v, bHasNoData, dfNoData)) continue;
+        const double dfIndex = std::floor((v - dfMin) * dfScale);
+        Count(dfIndex < 0 ? -1 : dfIndex >= nBuckets ? nBuckets : static_cast<int>(dfIndex));
+    }
+}
+
+void ToDouble(const void *pSrc, GDALDataType eType, size_t nPixels, double *padfDst)
+{
+    if (!GDALDataTypeIsComplex(eType)) {
+        GDALCopyWords64(pSrc, eType, GDALGetDataTypeSizeBytes(eType), padfDst, GDT_Float64, sizeof(double),
+                        static_cast<GPtrDiff_t>(nPixels));
+        return;
+    }
+    if (eType == GDT_CFloat32) {
+        const float *pafSrc = static_cast<const float *>(pSrc);
+        for (size_t i = 0; i < nPixels; i++) {
+            const double re = pafSrc[2 * i], im = pafSrc[2 * i + 1];
+            padfDst[i] = std::sqrt(re * re + im * im);
+        }
+        return;
+    }
+    // Other complex types go through CFloat64 in small strips
+    constexpr size_t nStrip = 256;
+    double adfComplex[2 * nStrip];
+    const int nSrcSize = GDALGetDataTypeSizeBytes(eType);
+    for (size_t i = 0; i < nPixels; i += nStrip) {
+        const size_t n = std::min(nStrip, nPixels - i);
+        GDALCopyWords64(static_cast<const GByte *>(pSrc) + i * nSrcSize, eType, nSrcSize, adfComplex, GDT_CFloat64,
+                        2 * sizeof(double), static_cast<GPtrDiff_t>(n));
+        for (size_t k = 0; k < n; k++) {
+            padfDst[i + k] = std::sqrt(adfComplex[2 * k] * adfComplex[2 * k] + adfComplex[2 * k + 1] * adfComplex[2 * k + 1]);
+        }
+    }
+}
+
+}  // namespace NisarStats
@@ -0,0 +1,55 @@
+// nisarstats.h
+/**************************************************************************************************************************/
+/* Copyright 2025, by the California Institute of Technology.                                                             */
+/* ALL RIGHTS RESERVED. United States Government Sponsorship acknowledged.                                                */
+/* Any commercial use must be negotiated with the Office of Technology Transfer at the California Institute of Technology.*/
+/*                                                                                                                        */
+/* This software may be subject to U.S. export control laws.                                                              */
+/* By accepting this software, the user agrees to comply with all applicable U.S. export laws and regulations.            */
+/* User has the responsibility to obtain export licenses, or other export authority as may be required                    */
+/* before exporting such information to foreign countries or providing access to foreign persons.                         */
+/**************************************************************************************************************************/
+
+#ifndef NISAR_STATS_H
+#define NISAR_STATS_H
+
+#include <cstddef>
+
+#include "gdal.h"
+
+/***************************************************************************/
+/* Exact statistics and histograms (NisarRasterBand::GetStatistics,        */
+/* GetHistogram, GetDefaultHistogram). Decoded chunks are converted to     */
+/* double rows (complex samples to their magnitude, as GDAL does) and      */
+/* reduced by SIMD kernels that skip NaN and the nodata value. Each        */
+/* decode worker keeps its own Partial; Merge() combines them with the     */
+/* pairwise mean/variance update, so the result does not depend on the     */
+/* chunk order.                                                            */
+/***************************************************************************/
+namespace NisarStats
+{
+
+struct Partial
+{
+    GUIntBig nValid = 0;
+    double dfMin = 0;
+    double dfMax = 0;
+    double dfMean = 0;
+    double dfM2 = 0;  // Sum of squared deviations from dfMean
+};
+
+// Folds nValues samples into oPartial; bHasNoData excludes dfNoData
+void Accumulate(const double *padfValues, size_t nValues, bool bHasNoData, double dfNoData, Partial &oPartial);
+void Merge(Partial &oInto, const Partial &oOther);
+
+// GDAL bucket layout: floor((v - dfMin) * nBuckets / (dfMax - dfMin));
+// out-of-range samples land in the end buckets if bIncludeOutOfRange
+void Histogram(const double *padfValues, size_t nValues, bool bHasNoData, double dfNoData, double dfMin,
+               double dfMax, int nBuckets, bool bIncludeOutOfRange, GUIntBig *panHistogram);
+
+// nPixels samples of eType to doubles; complex types to their magnitude
+void ToDouble(const void *pSrc, GDALDataType eType, size_t nPixels, double *padfDst);
+
+}  // namespace NisarStats
+
+#endif  // NISAR_STATS_H
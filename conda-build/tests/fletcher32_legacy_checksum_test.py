@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""
+Fletcher32 checksum test for the native filter pipeline.
+
+Writes a small NISAR-like GCOV layer with SHUFFLE+DEFLATE+FLETCHER32, then
+rewrites every stored checksum in the byte order of files written before
+HDF5 1.6.3 (bytes swapped within each 16-bit half). With
+NISAR_VERIFY_CHECKSUMS=YES the driver must accept those chunks and return
+the same pixels as h5py, and must reject a chunk whose checksum is corrupt.
+
+Example:
+    python fletcher32_legacy_checksum_test.py /tmp/fletcher32_GCOV.h5
+"""
+import argparse
+import os
+import struct
+import sys
+
+LAYER = "science/LSAR/GCOV/grids/frequencyA/HHHH"
+SIZE = 1024
+CHUNK = 256
+
+
+def fletcher32(data):
+    # HDF5's H5_checksum_fletcher32: big-endian 16-bit words, folded every 360
+    sum1 = sum2 = 0
+    words = len(data) // 2
+    pos = 0
+    while words:
+        batch = min(words, 360)
+        words -= batch
+        for _ in range(batch):
+            sum1 += (data[pos] << 8) | data[pos + 1]
+            sum2 += sum1
+            pos += 2
+        sum1 = (sum1 & 0xFFFF) + (sum1 >> 16)
+        sum2 = (sum2 & 0xFFFF) + (sum2 >> 16)
+    if len(data) % 2:
+        sum1 += data[pos] << 8
+        sum2 += sum1
+        sum1 = (sum1 & 0xFFFF) + (sum1 >> 16)
+        sum2 = (sum2 & 0xFFFF) + (sum2 >> 16)
+    sum1 = (sum1 & 0xFFFF) + (sum1 >> 16)
+    sum2 = (sum2 & 0xFFFF) + (sum2 >> 16)
+    return (sum2 << 16) | sum1
+
+
+def generate_granule(path):
+    import h5py
+    import numpy as np
+
+    rng = np.random.default_rng(7)
+    with h5py.File(path, "w") as f:
+        ident = f.create_group("science/LSAR/identification")
+        ident.create_dataset("productType", data=np.bytes_("GCOV"))
+        ident.create_dataset("missionId", data=np.bytes_("NISAR"))
+        grid = f.create_group("science/LSAR/GCOV/grids/frequencyA")
+        grid.create_dataset("xCoordinates", data=np.arange(SIZE, dtype="f8") * 20.0 + 500000.0)
+        grid.create_dataset("yCoordinates", data=4000000.0 - np.arange(SIZE, dtype="f8") * 20.0)
+        grid.create_dataset("HHHH", data=rng.gamma(1.0, 0.05, size=(SIZE, SIZE)).astype("f4"),
+                            chunks=(CHUNK, CHUNK), shuffle=True, compression="gzip", fletcher32=True)
+
+
+def chunk_extents(path):
+    import h5py
+
+    with h5py.File(path, "r") as f:
+        dsid = f[LAYER].id
+        return [(info.byte_offset, info.size)
+                for info in (dsid.get_chunk_info(i) for i in range(dsid.get_num_chunks()))]
+
+
+def rewrite_checksums(path, legacy, corrupt_first=False):
+    with open(path, "r+b") as fp:
+        for n, (offset, size) in enumerate(chunk_extents(path)):
+            fp.seek(offset)
+            payload = fp.read(size - 4)
+            stored = struct.unpack("<I", fp.read(4))[0]
+            checksum = fletcher32(payload)
+            if not legacy and stored != checksum:
+                raise RuntimeError(f"chunk {n}: reference Fletcher32 disagrees with HDF5")
+            d = struct.pack("<I", checksum)
+            out = bytes([d[1], d[0], d[3], d[2]]) if legacy else d
+            if corrupt_first and n == 0:
+                out = bytes([out[0] ^ 0xFF]) + out[1:]
+            fp.seek(offset + size - 4)
+            fp.write(out)
+
+
+def read_layer(gdal, path):
+    ds = gdal.Open(f"NISAR:{os.path.abspath(path)}://{LAYER}")
+    band = ds.GetRasterBand(1)
+    data = band.ReadRaster(0, 0, ds.RasterXSize, ds.RasterYSize)
+    ds = None
+    return data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("granule", help="Path of the test granule (overwritten)")
+    args = parser.parse_args()
+
+    import h5py
+    from osgeo import gdal
+    gdal.UseExceptions()
+    gdal.SetConfigOption("NISAR_VERIFY_CHECKSUMS", "YES")
+    gdal.SetConfigOption("GDAL_CACHEMAX", "0")
+
+    generate_granule(args.granule)
+    rewrite_checksums(args.granule, legacy=False)  # Checks the reference against HDF5
+    rewrite_checksums(args.granule, legacy=True)
+    with h5py.File(args.granule, "r") as f:
+        expected = f[LAYER][...].tobytes()
+
+    failures = 0
+    if read_layer(gdal, args.granule) != expected:
+        print("FAIL: legacy byte-order checksums were not accepted or pixels differ")
+        failures += 1
+    else:
+        print("PASS: legacy byte-order checksums")
+
+    rewrite_checksums(args.granule, legacy=True, corrupt_first=True)
+    try:
+        read_layer(gdal, args.granule)
+        print("FAIL: a corrupt checksum was accepted")
+        failures += 1
+    except RuntimeError:
+        print("PASS: corrupt checksum rejected")
+
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+Tail-latency benchmark for hedged / deadline-aware chunk requests.
+
+Reuses the throttled range server from range_server_benchmark.py and injects a
+per-request delay before the first byte, drawn from a configurable distribution.
+Random single-block reads (the access pattern of a tile server) are timed with
+hedging off and on, and the p50/p90/p99 latencies are compared.
+
+Latency distributions:
+    fixed:MS                 every request waits MS
+    lognormal:MEDIAN_MS,SIGMA
+    bimodal:FAST_MS,SLOW_MS,P_SLOW   e.g. bimodal:20,1500,0.02
+
+Example:
+    python hedged_latency_benchmark.py GCOV.h5 \
+        --subdataset //science/LSAR/GCOV/grids/frequencyA/HHHH \
+        --latency bimodal:20,1500,0.02 --reads 300 --deadline-ms 400
+"""
+import argparse
+import math
+import os
+import random
+import sys
+import time
+
+from range_server_benchmark import ThrottledRangeHandler, configure_gdal, start_server
+
+
+def make_latency_sampler(spec, seed):
+    rng = random.Random(seed)
+    kind, _, params = spec.partition(":")
+    values = [float(v) for v in params.split(",")] if params else []
+    if kind == "fixed":
+        return lambda: values[0] / 1000.0
+    if kind == "lognormal":
+        median, sigma = values
+        return lambda: rng.lognormvariate(math.log(median), sigma) / 1000.0
+    if kind == "bimodal":
+        fast, slow, p_slow = values
+        return lambda: (slow if rng.random() < p_slow else fast) / 1000.0
+    raise ValueError(f"Unknown latency distribution '{spec}'")
+
+
+class LatencyInjectingHandler(ThrottledRangeHandler):
+    """Delays every ranged GET by a sample from server.latency_sampler."""
+
+    def do_GET(self):
+        if self.headers.get("Range"):
+            time.sleep(self.server.latency_sampler())
+        super().do_GET()
+
+
+def percentile(values, pct):
+    ordered = sorted(values)
+    idx = min(len(ordered) - 1, int(pct / 100.0 * len(ordered)))
+    return ordered[idx]
+
+
+def run_reads(gdal, path, blocks, block_size):
+    timings = []
+    for bx, by in blocks:
+        # Fresh dataset per read so no block is served from GDAL's cache
+        ds = gdal.Open(path)
+        band = ds.GetRasterBand(1)
+        xsize = min(block_size[0], ds.RasterXSize - bx * block_size[0])
+        ysize = min(block_size[1], ds.RasterYSize - by * block_size[1])
+        t0 = time.perf_counter()
+        band.ReadRaster(bx * block_size[0], by * block_size[1], xsize, ysize)
+        timings.append((time.perf_counter() - t0) * 1000.0)
+        ds = None
+    return timings
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", help="Local NISAR HDF5 file to serve")
+    parser.add_argument("--subdataset", required=True, help="HDF5 path of the layer")
+    parser.add_argument("--latency", default="bimodal:20,1500,0.02", help="Injected latency distribution")
+    parser.add_argument("--rate-mbps", type=float, default=0.0, help="Per-connection bandwidth cap in MB/s (0 = unthrottled)")
+    parser.add_argument("--reads", type=int, default=200, help="Number of random block reads per configuration")
+    parser.add_argument("--prefetch-grid", type=int, default=2, help="NISAR_PREFETCH_GRID (neighbours fetched per read)")
+    parser.add_argument("--hedge-percentile", type=float, default=95.0, help="NISAR_HEDGE_PERCENTILE")
+    parser.add_argument("--deadline-ms", type=float, default=0.0, help="NISAR_READ_DEADLINE_MS for the hedged run (0 = none)")
+    parser.add_argument("--seed", type=int, default=1234)
+    args = parser.parse_args()
+
+    from osgeo import gdal
+    gdal.UseExceptions()
+
+    server = start_server(os.path.abspath(args.file), args.rate_mbps * 1024 * 1024, LatencyInjectingHandler)
+    server.latency_sampler = make_latency_sampler(args.latency, args.seed)
+    path = f"NISAR:/vsicurl/{server.url()}:{args.subdataset}"
+    print(f"Serving {args.file} at {server.url()} with latency {args.latency}")
+
+    # Force the multi-range path: mega-fetch would coalesce everything into one request
+    common = {
+        "NISAR_PREFETCH_GRID": str(args.prefetch_grid),
+        "NISAR_MAX_MEGAFETCH_BYTES": "0",
+    }
+    configure_gdal(gdal, common)
+    ds = gdal.Open(path)
+    block_size = ds.GetRasterBand(1).GetBlockSize()
+    nbx = (ds.RasterXSize + block_size[0] - 1) // block_size[0]
+    nby = (ds.RasterYSize + block_size[1] - 1) // block_size[1]
+    ds = None
+
+    rng = random.Random(args.seed)
+    blocks = [(rng.randrange(nbx), rng.randrange(nby)) for _ in range(args.reads)]
+
+    runs = [
+        ("baseline", {"NISAR_HEDGE_REQUESTS": "NO", "NISAR_READ_DEADLINE_MS": "0"}),
+        ("hedged", {"NISAR_HEDGE_REQUESTS": "YES",
+                    "NISAR_HEDGE_PERCENTILE": str(args.hedge_percentile),
+                    "NISAR_READ_DEADLINE_MS": str(args.deadline_ms)}),
+    ]
+    print(f"{'config':10s} {'p50 ms':>10s} {'p90 ms':>10s} {'p99 ms':>10s} {'max ms':>10s} {'requests':>10s}")
+    for name, options in runs:
+        configure_gdal(gdal, {**common, **options})
+        server.reset_stats()
+        timings = run_reads(gdal, path, blocks, block_size)
+        print(f"{name:10s} {percentile(timings, 50):10.1f} {percentile(timings, 90):10.1f} "
+              f"{percentile(timings, 99):10.1f} {max(timings):10.1f} {server.requests:10d}")
+
+    server.shutdown()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+Queue-depth scaling benchmark for the io_uring local reader.
+
+Generates (once) a synthetic NISAR-like GCOV granule: a float32 backscatter
+layer under science/LSAR/GCOV/grids/frequencyA, chunked 512x512 with
+SHUFFLE+DEFLATE like the production products. It then reads the full layer
+through the NISAR driver with the VSI, mmap and io_uring local readers,
+sweeping NISAR_IO_URING_QUEUE_DEPTH.
+
+The default size (~10 GB uncompressed, 51200 x 51200) needs as much free
+disk; use --size to scale down for a quick run. Run as root (or pass
+--direct) so every pass starts from a cold page cache.
+
+Example:
+    python io_uring_queue_depth_benchmark.py /nvme/synthetic_GCOV.h5 \
+        --queue-depths 1 4 16 64 256 --direct
+"""
+import argparse
+import os
+import sys
+import time
+
+LAYER = "science/LSAR/GCOV/grids/frequencyA/HHHH"
+CHUNK = 512
+
+
+def generate_granule(path, size, compression_level):
+    import h5py
+    import numpy as np
+
+    print(f"Generating {size} x {size} synthetic granule at {path} ...")
+    rng = np.random.default_rng(42)
+    with h5py.File(path, "w", libver="latest") as f:
+        ident = f.create_group("science/LSAR/identification")
+        ident.create_dataset("productType", data=np.bytes_("GCOV"))
+        ident.create_dataset("missionId", data=np.bytes_("NISAR"))
+        grid = f.create_group("science/LSAR/GCOV/grids/frequencyA")
+        grid.create_dataset("xCoordinates", data=np.arange(size, dtype="f8") * 20.0 + 500000.0)
+        grid.create_dataset("yCoordinates", data=4000000.0 - np.arange(size, dtype="f8") * 20.0)
+        dset = grid.create_dataset(
+            "HHHH", shape=(size, size), dtype="f4", chunks=(CHUNK, CHUNK),
+            shuffle=True, compression="gzip", compression_opts=compression_level,
+            fillvalue=np.float32(np.nan))
+        # Speckle-like gamma noise compresses about as well as real backscatter
+        for y in range(0, size, CHUNK):
+            rows = min(CHUNK, size - y)
+            dset[y:y + rows, :] = rng.gamma(1.0, 0.05, size=(rows, size)).astype("f4")
+            print(f"\r  rows {y + rows}/{size}", end="", flush=True)
+    print()
+
+
+def drop_page_cache(path):
+    # Best effort: evict just this file, then fall back to the global knob
+    try:
+        fd = os.open(path, os.O_RDONLY)
+        os.posix_fadvise(fd, 0, 0, os.POSIX_FADV_DONTNEED)
+        os.close(fd)
+    except (AttributeError, OSError):
+        pass
+    try:
+        with open("/proc/sys/vm/drop_caches", "w") as f:
+            f.write("1\n")
+    except OSError:
+        pass
+
+
+def timed_full_read(gdal, path, options, granule):
+    for key, value in options.items():
+        gdal.SetConfigOption(key, value)
+    drop_page_cache(granule)
+    # ROW_MAJOR keeps the read on IReadBlock's per-chunk batches, whose
+    # queue depth is what this sweeps; the default AUTO streams the full
+    # raster as a few large file-order ranges instead
+    ds = gdal.OpenEx(path, gdal.OF_RASTER, open_options=["SCAN_ORDER=ROW_MAJOR"])
+    band = ds.GetRasterBand(1)
+    t0 = time.perf_counter()
+    band.ReadRaster(0, 0, ds.RasterXSize, ds.RasterYSize)
+    elapsed = time.perf_counter() - t0
+    ds = None
+    for key in options:
+        gdal.SetConfigOption(key, None)
+    return elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("granule", help="Path of the synthetic granule (generated if missing)")
+    parser.add_argument("--size", type=int, default=51200, help="Raster width/height in pixels")
+    parser.add_argument("--compression-level", type=int, default=4)
+    parser.add_argument("--queue-depths", type=int, nargs="+", default=[1, 4, 16, 64, 256])
+    parser.add_argument("--prefetch-grid", type=int, default=16, help="NISAR_PREFETCH_GRID (ranges per batch = grid^2)")
+    parser.add_argument("--direct", action="store_true", help="NISAR_IO_URING_DIRECT=YES (O_DIRECT)")
+    args = parser.parse_args()
+
+    if not os.path.exists(args.granule):
+        generate_granule(args.granule, args.size, args.compression_level)
+
+    from osgeo import gdal
+    gdal.UseExceptions()
+    gdal.SetConfigOption("GDAL_CACHEMAX", "4096")
+
+    path = f"NISAR:{os.path.abspath(args.granule)}://{LAYER}"
+    raw_mb = os.path.getsize(args.granule) / (1024 * 1024)
+    common = {
+        "NISAR_PREFETCH_GRID": str(args.prefetch_grid),
+        "NISAR_MAX_MEGAFETCH_BYTES": "0",  # One range per chunk, as the uring batch sees it
+    }
+
+    runs = [
+        ("vsi", {"NISAR_USE_MMAP": "NO", "NISAR_USE_IO_URING": "NO"}),
+        ("mmap", {"NISAR_USE_MMAP": "YES", "NISAR_USE_IO_URING": "NO"}),
+    ]
+    for qd in args.queue_depths:
+        runs.append((f"io_uring qd={qd}", {
+            "NISAR_USE_IO_URING": "YES",
+            "NISAR_IO_URING_QUEUE_DEPTH": str(qd),
+            "NISAR_IO_URING_DIRECT": "YES" if args.direct else "NO",
+        }))
+
+    print(f"Granule: {args.granule} ({raw_mb:.0f} MB on disk)")
+    print(f"{'reader':20s} {'time s':>10s} {'MB/s (file)':>12s}")
+    for name, options in runs:
+        elapsed = timed_full_read(gdal, path, {**common, **options}, args.granule)
+        print(f"{name:20s} {elapsed:10.2f} {raw_mb / elapsed:12.1f}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+Local HTTP range-server stand-in for S3 and a read benchmark for the NISAR driver.
+
+The server answers HEAD and ranged GET requests for a single file and throttles
+each connection to a fixed bandwidth, mimicking the per-stream ceiling seen
+against S3. The benchmark then reads a full NISAR raster over /vsicurl/ with
+different NISAR_FETCH_CONCURRENCY settings and reports wall time and throughput.
+
+Example:
+    python range_server_benchmark.py GCOV.h5 \
+        --subdataset //science/LSAR/GCOV/grids/frequencyA/HHHH \
+        --rate-mbps 40 --concurrency 1 4 8 16
+"""
+import argparse
+import http.server
+import os
+import re
+import socketserver
+import sys
+import threading
+import time
+
+RANGE_RE = re.compile(r"bytes=(\d+)-(\d*)")
+
+
+class ThrottledRangeHandler(http.server.BaseHTTPRequestHandler):
+    """Serves byte ranges of server.file_path at server.rate_bps per connection."""
+
+    protocol_version = "HTTP/1.1"
+    block_size = 64 * 1024
+
+    def log_message(self, fmt, *args):
+        if self.server.verbose:
+            super().log_message(fmt, *args)
+
+    def _send_headers(self, status, start, length, total):
+        self.send_response(status)
+        self.send_header("Accept-Ranges", "bytes")
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(length))
+        if status == 206:
+            self.send_header("Content-Range", f"bytes {start}-{start + length - 1}/{total}")
+        self.end_headers()
+
+    def _parse_range(self, total):
+        header = self.headers.get("Range")
+        if not header:
+            return 200, 0, total
+        m = RANGE_RE.match(header.strip())
+        if not m:
+            return 416, 0, 0
+        start = int(m.group(1))
+        end = int(m.group(2)) if m.group(2) else total - 1
+        end = min(end, total - 1)
+        if start > end:
+            return 416, 0, 0
+        return 206, start, end - start + 1
+
+    def do_HEAD(self):
+        total = os.path.getsize(self.server.file_path)
+        self._send_headers(200, 0, total, total)
+
+    def do_GET(self):
+        total = os.path.getsize(self.server.file_path)
+        status, start, length = self._parse_range(total)
+        if status == 416:
+            self.send_response(416)
+            self.send_header("Content-Range", f"bytes */{total}")
+            self.send_header("Content-Length", "0")
+            self.end_headers()
+            return
+
+        with self.server.stats_lock:
+            self.server.requests += 1
+            self.server.bytes_sent += length
+
+        self._send_headers(status, start, length, total)
+        rate = self.server.rate_bps
+        t0 = time.monotonic()
+        sent = 0
+        with open(self.server.file_path, "rb") as f:
+            f.seek(start)
+            while sent < length:
+                buf = f.read(min(self.block_size, length - sent))
+                if not buf:
+                    break
+                try:
+                    self.wfile.write(buf)
+                except (BrokenPipeError, ConnectionResetError):
+                    return
+                sent += len(buf)
+                if rate > 0:
+                    # Token bucket: sleep until this connection is back under its budget
+                    ahead = sent / rate - (time.monotonic() - t0)
+                    if ahead > 0:
+                        time.sleep(ahead)
+
+
+class RangeServer(socketserver.ThreadingMixIn, http.server.HTTPServer):
+    daemon_threads = True
+    allow_reuse_address = True
+
+    def __init__(self, file_path, rate_bps, handler=ThrottledRangeHandler, verbose=False):
+        super().__init__(("127.0.0.1", 0), handler)
+        self.file_path = file_path
+        self.rate_bps = rate_bps
+        self.verbose = verbose
+        self.stats_lock = threading.Lock()
+        self.requests = 0
+        self.bytes_sent = 0
+
+    def url(self):
+        return f"http://127.0.0.1:{self.server_address[1]}/{os.path.basename(self.file_path)}"
+
+    def reset_stats(self):
+        with self.stats_lock:
+            self.requests = 0
+            self.bytes_sent = 0
+
+
+def start_server(file_path, rate_bps, handler=ThrottledRangeHandler, verbose=False):
+    server = RangeServer(file_path, rate_bps, handler, verbose)
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+    thread.start()
+    return server
+
+
+def read_full_raster(gdal, path):
+    ds = gdal.Open(path)
+    if ds is None:
+        raise RuntimeError(f"Could not open {path}")
+    band = ds.GetRasterBand(1)
+    t0 = time.perf_counter()
+    band.ReadRaster(0, 0, ds.RasterXSize, ds.RasterYSize)
+    elapsed = time.perf_counter() - t0
+    ds = None
+    return elapsed
+
+
+def configure_gdal(gdal, extra):
+    # Cold caches every run so the network path is what gets measured
+    base = {
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+        "VSI_CACHE": "FALSE",
+        "CPL_VSIL_CURL_NON_CACHED": "/vsicurl/",
+        "GDAL_CACHEMAX": "2048",
+    }
+    base.update(extra)
+    for key, value in base.items():
+        gdal.SetConfigOption(key, value)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", help="Local NISAR HDF5 file to serve")
+    parser.add_argument("--subdataset", required=True, help="HDF5 path of the layer, e.g. //science/LSAR/GCOV/grids/frequencyA/HHHH")
+    parser.add_argument("--rate-mbps", type=float, default=40.0, help="Per-connection bandwidth cap in MB/s (0 = unthrottled)")
+    parser.add_argument("--concurrency", type=int, nargs="+", default=[1, 4, 8], help="NISAR_FETCH_CONCURRENCY values to compare")
+    parser.add_argument("--part-size-mb", type=float, default=8.0, help="NISAR_FETCH_PART_SIZE in MiB")
+    parser.add_argument("--megafetch-mb", type=float, default=64.0, help="NISAR_MAX_MEGAFETCH_BYTES in MiB")
+    parser.add_argument("--prefetch-grid", type=int, default=24, help="NISAR_PREFETCH_GRID")
+    parser.add_argument("--repeat", type=int, default=1, help="Runs per setting (best time is reported)")
+    parser.add_argument("--verbose", action="store_true", help="Log every HTTP request")
+    args = parser.parse_args()
+
+    from osgeo import gdal
+    gdal.UseExceptions()
+
+    server = start_server(os.path.abspath(args.file), args.rate_mbps * 1024 * 1024, verbose=args.verbose)
+    path = f"NISAR:/vsicurl/{server.url()}:{args.subdataset}"
+    print(f"Serving {args.file} at {server.url()} ({args.rate_mbps} MB/s per connection)")
+
+    results = []
+    for concurrency in args.concurrency:
+        configure_gdal(gdal, {
+            "NISAR_FETCH_CONCURRENCY": str(concurrency),
+            "NISAR_FETCH_PART_SIZE": str(int(args.part_size_mb * 1024 * 1024)),
+            "NISAR_MAX_MEGAFETCH_BYTES": str(int(args.megafetch_mb * 1024 * 1024)),
+            "NISAR_PREFETCH_GRID": str(args.prefetch_grid),
+        })
+        best = None
+        for _ in range(args.repeat):
+            server.reset_stats()
+            elapsed = read_full_raster(gdal, path)
+            best = elapsed if best is None else min(best, elapsed)
+        mb = server.bytes_sent / (1024 * 1024)
+        results.append((concurrency, best, mb, server.requests))
+        print(f"  concurrency={concurrency:3d}  time={best:8.2f}s  transferred={mb:9.1f} MB  "
+              f"requests={server.requests:6d}  throughput={mb / best:8.1f} MB/s")
+
+    server.shutdown()
+    if results:
+        base = results[0][1]
+        print("\nSpeedup vs first setting:")
+        for concurrency, elapsed, _, _ in results:
+            print(f"  concurrency={concurrency:3d}  {base / elapsed:5.2f}x")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())